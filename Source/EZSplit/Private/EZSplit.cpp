@@ -22,9 +22,51 @@
 #include "UObject/SavePackage.h"
 
 #include "ObjectTools.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Misc/ScopedSlowTask.h"
+#include "HAL/IConsoleManager.h"
+#include "StaticMeshResources.h"
+#include "Algo/Sort.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "StaticMeshOperations.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/UObjectGlobals.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogEZSplit, Log, All);
 
+static TAutoConsoleVariable<int32> CVarEZSplitStreamingBudgetMB(
+    TEXT("EZSplit.StreamingBudgetMB"),
+    512,
+    TEXT("Memory cap (MB) for the part data built in each split batch.\n")
+    TEXT("Meshes whose split would exceed it are processed in streaming batches of at most this size.\n")
+    TEXT("The editor split saves and unloads each batch before building the next, so apart from the index-only part labels its peak memory stays near this cap whatever the mesh size.\n")
+    TEXT("Transient splits return every part, so their parts stay loaded.\n")
+    TEXT("0 disables streaming."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarEZSplitMergeClusterMaxTriangles(
+    TEXT("EZSplit.MergeCluster.MaxTriangles"),
+    200000,
+    TEXT("Triangle budget per merged mesh when merging a selection in clusters. 0 disables the limit."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEZSplitMergeClusterMaxExtent(
+    TEXT("EZSplit.MergeCluster.MaxExtent"),
+    10000.0f,
+    TEXT("Largest bounds extent (cm) per merged mesh when merging a selection in clusters. 0 disables the limit."),
+    ECVF_Default);
+
+// Rough MeshDescription cost of one split triangle: three vertex instances with their attributes,
+// up to three vertices, and the triangle, polygon and edge topology
+static int64 EstimateSplitBytesPerTriangle(int32 NumUVChannels)
+{
+    const int64 VertexInstanceBytes = sizeof(FVector3f) * 2 + sizeof(float) + sizeof(FVector4f) + sizeof(FVector2f) * NumUVChannels + 16;
+    const int64 VertexBytes = sizeof(FVector3f) + 32;
+    const int64 TopologyBytes = 128;
+    return VertexInstanceBytes * 3 + VertexBytes * 3 + TopologyBytes;
+}
+
 void FEZSplitModule::StartupModule()
 {
     UE_LOG(LogEZSplit, Log, TEXT("EZSplit: StartupModule called."));
@@ -51,6 +93,14 @@ void FEZSplitModule::StartupModule()
             FUIAction(FExecuteAction::CreateRaw(this, &FEZSplitModule::OnMergeMeshButtonClicked))
         );
 
+        Section.AddMenuEntry(
+            "MergeMeshClustered",
+            FText::FromString("Merge Selected (Clustered)"),
+            FText::FromString("Merge the selected static meshes into spatially coherent merged meshes that stay cullable."),
+            FSlateIcon(),
+            FUIAction(FExecuteAction::CreateRaw(this, &FEZSplitModule::OnMergeClusteredMeshButtonClicked))
+        );
+
         UE_LOG(LogEZSplit, Log, TEXT("EZSplit: Actor context menu extended successfully."));
     }
 }
@@ -96,6 +146,14 @@ void FEZSplitModule::AddMenuEntry(FMenuBuilder& MenuBuilder)
             FSlateIcon(),
             FUIAction(FExecuteAction::CreateRaw(this, &FEZSplitModule::OnMergeMeshButtonClicked))
         );
+
+        UE_LOG(LogEZSplit, Log, TEXT("EZSplit: Adding Clustered Merge menu entry for selected static mesh actor."));
+        MenuBuilder.AddMenuEntry(
+            FText::FromString("Merge Selected (Clustered)"),
+            FText::FromString("Merge the selected static meshes into spatially coherent merged meshes that stay cullable."),
+            FSlateIcon(),
+            FUIAction(FExecuteAction::CreateRaw(this, &FEZSplitModule::OnMergeClusteredMeshButtonClicked))
+        );
     }
     else
     {
@@ -123,6 +181,11 @@ void FEZSplitModule::OnMergeMeshButtonClicked()
     MergeSelectedStaticMeshes();
 }
 
+void FEZSplitModule::OnMergeClusteredMeshButtonClicked()
+{
+    MergeSelectedStaticMeshesClustered();
+}
+
 
 // Split
 void SplitMesh(AActor* Actor)
@@ -162,6 +225,17 @@ void SplitMesh(AActor* Actor)
     FPositionVertexBuffer& VertexBuffer = LODResource.VertexBuffers.PositionVertexBuffer;
     FIndexArrayView Indices = LODResource.IndexBuffer.GetArrayView();
 
+    // Large meshes are split in bounded batches instead of copying every attribute up front
+    const int64 StreamingBudgetBytes = int64(CVarEZSplitStreamingBudgetMB.GetValueOnGameThread()) * 1024 * 1024;
+    const int64 EstimatedSplitBytes = int64(Indices.Num() / 3) * EstimateSplitBytesPerTriangle(LODResource.GetNumTexCoords());
+    if (StreamingBudgetBytes > 0 && EstimatedSplitBytes > StreamingBudgetBytes)
+    {
+        UE_LOG(LogEZSplit, Log, TEXT("SplitMesh: Estimated %lld MB exceeds budget of %lld MB, using streaming split."),
+            EstimatedSplitBytes / (1024 * 1024), StreamingBudgetBytes / (1024 * 1024));
+        SplitMeshStreaming(Actor, MeshComponent->GetComponentTransform(), BaseMesh, StreamingBudgetBytes);
+        return;
+    }
+
     // Extract vertices
     TArray<FVector> Vertices;
     TArray<FVector> Normals, Tangents;
@@ -202,7 +276,7 @@ void SplitMesh(AActor* Actor)
     // Create new static meshes for each component
     TArray<UStaticMesh*> SplitMesh = CreateNewStaticMeshes(BaseMesh, Vertices, TriangleIndices, Components, Normals, Tangents, Colors, UVChannels);
 
-    HandleSplitMeshPlacement(Actor, SplitMesh, BaseMesh->GetName());
+    HandleSplitMeshPlacement(Actor, MeshComponent->GetComponentTransform(), SplitMesh, BaseMesh->GetName());
 }
 
 void FindConnectedComponents(
@@ -274,33 +348,11 @@ TArray<UStaticMesh*> CreateNewStaticMeshes(
     const TArray<FColor>& Colors,
     const TArray<TArray<FVector2D>>& UVChannels)
 {
-    // Get base mesh details
     FString BaseMeshName = BaseMesh->GetName();
-    FString BaseMeshPath = FPackageName::GetLongPackagePath(BaseMesh->GetOutermost()->GetName());
-    FString DestinationFolder = BaseMeshPath + TEXT("/") + BaseMeshName;
-    FString SplitFolderPath = DestinationFolder + TEXT("/Split");
-
-    // Load the Asset Registry and Asset Tools
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    AssetRegistryModule.Get().AddPath(SplitFolderPath);
+    FString SplitFolderPath = PrepareSplitFolder(BaseMesh);
 
-    // Move the original static mesh asset to the new destination folder
     FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
 
-    FAssetRenameData RenameData(BaseMesh, DestinationFolder, BaseMeshName);
-    TArray<FAssetRenameData> RenameDataArray;
-    RenameDataArray.Add(RenameData);
-
-    bool bRenameSuccess = AssetToolsModule.Get().RenameAssets(RenameDataArray);
-    if (!bRenameSuccess)
-    {
-        //UE_LOG(LogEZSplit, Warning, TEXT("Failed to move original static mesh: %s to %s"), *OriginalAssetPath, *NewBaseMeshPath);
-    }
-    else
-    {
-        //UE_LOG(LogEZSplit, Log, TEXT("Moved original static mesh: %s to %s"), *OriginalAssetPath, *NewBaseMeshPath);
-    }
-
     // Create new split meshes in the "/Split" folder
     TArray<UStaticMesh*> SplitMeshes;
     for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ++ComponentIndex)
@@ -315,6 +367,12 @@ TArray<UStaticMesh*> CreateNewStaticMeshes(
 
         if (NewStaticMesh)
         {
+            // The part geometry comes from LOD 0 render data, which already has the build scale applied
+            for (int32 LodIndex = 0; LodIndex < NewStaticMesh->GetNumSourceModels(); ++LodIndex)
+            {
+                NewStaticMesh->GetSourceModel(LodIndex).BuildSettings.BuildScale3D = FVector::OneVector;
+            }
+
             // Prepare MeshDescription for the split mesh
             FMeshDescription* MeshDescription = NewStaticMesh->CreateMeshDescription(0);
             if (!MeshDescription)
@@ -406,8 +464,447 @@ TArray<UStaticMesh*> CreateNewStaticMeshes(
     return SplitMeshes;
 }
 
+void SplitMeshStreaming(AActor* Actor, const FTransform& PartTransform, UStaticMesh* BaseMesh, int64 BatchBudgetBytes)
+{
+    FString BaseMeshName = BaseMesh->GetName();
+    FString SplitFolderPath = PrepareSplitFolder(BaseMesh);
+
+    auto CreatePartMesh = [&BaseMesh, &BaseMeshName, &SplitFolderPath](int32 PartIndex) -> UStaticMesh* {
+        FString NewMeshName = FString::Printf(TEXT("%s_%d"), *BaseMeshName, PartIndex);
+        FString NewMeshPath = SplitFolderPath + TEXT("/") + NewMeshName;
+
+        UPackage* Package = CreatePackage(*NewMeshPath);
+        if (FindObject<UStaticMesh>(Package, *NewMeshName))
+        {
+            UE_LOG(LogEZSplit, Warning, TEXT("Failed to create new static mesh: %s already exists"), *NewMeshPath);
+            return nullptr;
+        }
+
+        return CreateEmptyStaticMeshFrom(BaseMesh, Package, FName(*NewMeshName), RF_Public | RF_Standalone);
+        };
+
+    // Each batch is saved and then released before the next one is built, so at most one batch of parts is loaded at a time
+    TArray<FSoftObjectPath> PartPaths;
+    auto SaveAndReleaseBatch = [&PartPaths](const TArray<UStaticMesh*>& BatchMeshes) {
+        for (UStaticMesh* NewStaticMesh : BatchMeshes)
+        {
+            FAssetRegistryModule::AssetCreated(NewStaticMesh);
+            NewStaticMesh->MarkPackageDirty();
+
+            FString MeshFileName = NewStaticMesh->GetOutermost()->GetName();
+            SavePackage(NewStaticMesh->GetOutermost(), MeshFileName);
+
+            UE_LOG(LogEZSplit, Log, TEXT("Created new static mesh: %s"), *NewStaticMesh->GetPathName());
+
+            // The part is on disk now, so it no longer has to stay loaded
+            PartPaths.Emplace(NewStaticMesh);
+            NewStaticMesh->ClearFlags(RF_Standalone);
+        }
+
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+        };
+
+    BuildSplitStaticMeshes(BaseMesh, BatchBudgetBytes, CreatePartMesh, SaveAndReleaseBatch);
+
+    // Placing the parts needs their render data, so they are loaded back from disk, without their source geometry
+    TArray<UStaticMesh*> SplitMeshes;
+    SplitMeshes.Reserve(PartPaths.Num());
+    for (const FSoftObjectPath& PartPath : PartPaths)
+    {
+        if (UStaticMesh* PartMesh = Cast<UStaticMesh>(PartPath.TryLoad()))
+        {
+            SplitMeshes.Add(PartMesh);
+        }
+        else
+        {
+            UE_LOG(LogEZSplit, Warning, TEXT("SplitMeshStreaming: Failed to load split part %s"), *PartPath.ToString());
+        }
+    }
+
+    if (SplitMeshes.Num() == 0)
+    {
+        UE_LOG(LogEZSplit, Warning, TEXT("SplitMeshStreaming: No parts created for %s"), *BaseMeshName);
+        return;
+    }
+
+    HandleSplitMeshPlacement(Actor, PartTransform, SplitMeshes, BaseMeshName);
+}
+
+int32 BuildSplitStaticMeshes(
+    UStaticMesh* BaseMesh,
+    int64 BatchBudgetBytes,
+    TFunctionRef<UStaticMesh*(int32 PartIndex)> CreatePartMesh,
+    TFunctionRef<void(const TArray<UStaticMesh*>& BatchMeshes)> OnBatchBuilt)
+{
+    int32 NumBuilt = 0;
+
+    FStaticMeshLODResources& LODResource = BaseMesh->GetRenderData()->LODResources[0];
+    FIndexArrayView Indices = LODResource.IndexBuffer.GetArrayView();
+    const int32 NumVertices = LODResource.VertexBuffers.PositionVertexBuffer.GetNumVertices();
+
+    // Index-only pass: one label per vertex and one triangle count per part
+    TArray<int32> VertexComponents;
+    TArray<int32> ComponentTriangleCounts;
+    const int32 NumComponents = LabelConnectedComponents(Indices, NumVertices, VertexComponents, ComponentTriangleCounts);
+    if (NumComponents == 0)
+    {
+        UE_LOG(LogEZSplit, Warning, TEXT("BuildSplitStaticMeshes: No triangles found in %s"), *BaseMesh->GetName());
+        return NumBuilt;
+    }
+
+    // Bucket the triangles by part once, so each batch reads only its own triangles
+    TArray<int32> ComponentTriangleOffsets;
+    TArray<int32> SortedTriangles;
+    SortTrianglesByComponent(Indices, VertexComponents, ComponentTriangleCounts, ComponentTriangleOffsets, SortedTriangles);
+    VertexComponents.Empty();
+
+    const int64 BytesPerTriangle = EstimateSplitBytesPerTriangle(LODResource.GetNumTexCoords());
+
+    FScopedSlowTask SlowTask(NumComponents, FText::FromString("Splitting mesh..."));
+    SlowTask.MakeDialogDelayed(1.0f);
+
+    int32 FirstComponent = 0;
+    while (FirstComponent < NumComponents)
+    {
+        // Take parts until the batch would exceed the budget; a single part larger than the budget forms its own batch
+        int32 EndComponent = FirstComponent;
+        int64 BatchBytes = 0;
+        do
+        {
+            BatchBytes += ComponentTriangleCounts[EndComponent] * BytesPerTriangle;
+            ++EndComponent;
+        } while (EndComponent < NumComponents && BatchBytes + ComponentTriangleCounts[EndComponent] * BytesPerTriangle <= BatchBudgetBytes);
+
+        const int32 BatchSize = EndComponent - FirstComponent;
+        if (BatchBytes > BatchBudgetBytes)
+        {
+            UE_LOG(LogEZSplit, Warning, TEXT("BuildSplitStaticMeshes: Part %d needs about %lld MB, above the streaming budget."),
+                FirstComponent, BatchBytes / (1024 * 1024));
+        }
+
+        TArray<FMeshDescription> MeshDescriptions;
+        BuildComponentMeshDescriptions(BaseMesh, ComponentTriangleOffsets, SortedTriangles, FirstComponent, BatchSize, MeshDescriptions);
+
+        TArray<UStaticMesh*> BatchMeshes;
+        BatchMeshes.Reserve(BatchSize);
+        for (int32 BatchIndex = 0; BatchIndex < BatchSize; ++BatchIndex)
+        {
+            UStaticMesh* NewStaticMesh = CreatePartMesh(FirstComponent + BatchIndex);
+            if (!NewStaticMesh)
+            {
+                continue;
+            }
+
+            NewStaticMesh->CreateMeshDescription(0, MoveTemp(MeshDescriptions[BatchIndex]));
+            NewStaticMesh->CommitMeshDescription(0);
+            NewStaticMesh->CreateBodySetup();
+            NewStaticMesh->SetLightingGuid();
+
+            BatchMeshes.Add(NewStaticMesh);
+        }
+
+        // The committed bulk data is all the meshes need from here on
+        MeshDescriptions.Empty();
+
+        UStaticMesh::BatchBuild(BatchMeshes, /*bInSilent=*/true);
+
+        for (UStaticMesh* NewStaticMesh : BatchMeshes)
+        {
+            // Drop the unpacked MeshDescription; it reloads from bulk data on demand
+            NewStaticMesh->ClearMeshDescriptions();
+        }
+
+        // The caller keeps or releases the batch; nothing here holds on to it
+        OnBatchBuilt(BatchMeshes);
+
+        NumBuilt += BatchMeshes.Num();
+        SlowTask.EnterProgressFrame(BatchSize);
+        FirstComponent = EndComponent;
+    }
+
+    return NumBuilt;
+}
+
+int32 LabelConnectedComponents(
+    const FIndexArrayView& Indices,
+    int32 NumVertices,
+    TArray<int32>& OutVertexComponents,
+    TArray<int32>& OutComponentTriangleCounts)
+{
+    // Union-find over vertex indices, always linking to the lowest index so every parent is below its child.
+    // The parent array is resolved in place into the per-vertex labels.
+    TArray<int32>& Parents = OutVertexComponents;
+    Parents.SetNumUninitialized(NumVertices);
+    for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+    {
+        Parents[Vertex] = Vertex;
+    }
+
+    auto FindRoot = [&Parents](int32 Vertex) -> int32 {
+        while (Parents[Vertex] != Vertex)
+        {
+            Parents[Vertex] = Parents[Parents[Vertex]];
+            Vertex = Parents[Vertex];
+        }
+        return Vertex;
+        };
+
+    const int32 NumTriangles = Indices.Num() / 3;
+    for (int32 Tri = 0; Tri < NumTriangles; ++Tri)
+    {
+        const int32 RootA = FindRoot(Indices[Tri * 3]);
+        const int32 RootB = FindRoot(Indices[Tri * 3 + 1]);
+        const int32 RootC = FindRoot(Indices[Tri * 3 + 2]);
+        const int32 Root = FMath::Min3(RootA, RootB, RootC);
+        Parents[RootA] = Root;
+        Parents[RootB] = Root;
+        Parents[RootC] = Root;
+    }
+
+    // Parents point to lower indices, so in ascending order a vertex's parent already holds its label
+    int32 NumLabels = 0;
+    for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+    {
+        Parents[Vertex] = (Parents[Vertex] == Vertex) ? NumLabels++ : Parents[Parents[Vertex]];
+    }
+
+    OutComponentTriangleCounts.Reset();
+    OutComponentTriangleCounts.SetNumZeroed(NumLabels);
+    for (int32 Tri = 0; Tri < NumTriangles; ++Tri)
+    {
+        ++OutComponentTriangleCounts[Parents[Indices[Tri * 3]]];
+    }
+
+    // Vertices no triangle uses would otherwise become empty parts
+    TArray<int32> LabelRemap;
+    LabelRemap.SetNumUninitialized(NumLabels);
+    int32 NumComponents = 0;
+    for (int32 Label = 0; Label < NumLabels; ++Label)
+    {
+        if (OutComponentTriangleCounts[Label] > 0)
+        {
+            OutComponentTriangleCounts[NumComponents] = OutComponentTriangleCounts[Label];
+            LabelRemap[Label] = NumComponents++;
+        }
+        else
+        {
+            LabelRemap[Label] = INDEX_NONE;
+        }
+    }
+    OutComponentTriangleCounts.SetNum(NumComponents);
+
+    for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+    {
+        Parents[Vertex] = LabelRemap[Parents[Vertex]];
+    }
+
+    return NumComponents;
+}
+
+void SortTrianglesByComponent(
+    const FIndexArrayView& Indices,
+    const TArray<int32>& VertexComponents,
+    const TArray<int32>& ComponentTriangleCounts,
+    TArray<int32>& OutComponentTriangleOffsets,
+    TArray<int32>& OutSortedTriangles)
+{
+    // Counting sort: prefix sums of the per-part counts give each part's range, then one pass fills the ranges
+    const int32 NumComponents = ComponentTriangleCounts.Num();
+    OutComponentTriangleOffsets.SetNumUninitialized(NumComponents + 1);
+    OutComponentTriangleOffsets[0] = 0;
+    for (int32 Component = 0; Component < NumComponents; ++Component)
+    {
+        OutComponentTriangleOffsets[Component + 1] = OutComponentTriangleOffsets[Component] + ComponentTriangleCounts[Component];
+    }
+
+    TArray<int32> WriteOffsets(OutComponentTriangleOffsets.GetData(), NumComponents);
+    OutSortedTriangles.SetNumUninitialized(OutComponentTriangleOffsets[NumComponents]);
+
+    const int32 NumTriangles = Indices.Num() / 3;
+    for (int32 Tri = 0; Tri < NumTriangles; ++Tri)
+    {
+        OutSortedTriangles[WriteOffsets[VertexComponents[Indices[Tri * 3]]]++] = Tri;
+    }
+}
+
+void BuildComponentMeshDescriptions(
+    UStaticMesh* BaseMesh,
+    const TArray<int32>& ComponentTriangleOffsets,
+    const TArray<int32>& SortedTriangles,
+    int32 FirstComponent,
+    int32 NumComponents,
+    TArray<FMeshDescription>& OutMeshDescriptions)
+{
+    const FStaticMeshLODResources& LODResource = BaseMesh->GetRenderData()->LODResources[0];
+    const FPositionVertexBuffer& PositionBuffer = LODResource.VertexBuffers.PositionVertexBuffer;
+    const FStaticMeshVertexBuffer& VertexBuffer = LODResource.VertexBuffers.StaticMeshVertexBuffer;
+    const FColorVertexBuffer& ColorBuffer = LODResource.VertexBuffers.ColorVertexBuffer;
+    const bool bHasColors = ColorBuffer.GetNumVertices() > 0;
+    const int32 NumUVChannels = LODResource.GetNumTexCoords();
+    FIndexArrayView Indices = LODResource.IndexBuffer.GetArrayView();
+
+    const TArray<FStaticMaterial>& StaticMaterials = BaseMesh->GetStaticMaterials();
+    const FName MaterialSlotName = StaticMaterials.Num() > 0 ? StaticMaterials[0].ImportedMaterialSlotName : NAME_None;
+
+    OutMeshDescriptions.Reset();
+    OutMeshDescriptions.SetNum(NumComponents);
+
+    TMap<uint32, FVertexID> VertexIDMap;
+    for (int32 PartIndex = 0; PartIndex < NumComponents; ++PartIndex)
+    {
+        const int32 Component = FirstComponent + PartIndex;
+        const int32 FirstTriangle = ComponentTriangleOffsets[Component];
+        const int32 NumTriangles = ComponentTriangleOffsets[Component + 1] - FirstTriangle;
+
+        FMeshDescription& MeshDescription = OutMeshDescriptions[PartIndex];
+        FStaticMeshAttributes Attributes(MeshDescription);
+        Attributes.Register();
+        Attributes.GetVertexInstanceUVs().SetNumChannels(NumUVChannels);
+
+        MeshDescription.ReserveNewVertices(NumTriangles * 3);
+        MeshDescription.ReserveNewVertexInstances(NumTriangles * 3);
+        MeshDescription.ReserveNewPolygons(NumTriangles);
+        MeshDescription.ReserveNewEdges(NumTriangles * 3);
+
+        FPolygonGroupID PolygonGroup = MeshDescription.CreatePolygonGroup();
+        Attributes.GetPolygonGroupMaterialSlotNames()[PolygonGroup] = MaterialSlotName;
+
+        // Cached attribute accessors, so the triangle loop does no attribute lookups
+        TVertexAttributesRef<FVector3f> Positions = Attributes.GetVertexPositions();
+        TVertexInstanceAttributesRef<FVector3f> Normals = Attributes.GetVertexInstanceNormals();
+        TVertexInstanceAttributesRef<FVector3f> Tangents = Attributes.GetVertexInstanceTangents();
+        TVertexInstanceAttributesRef<FVector4f> Colors = Attributes.GetVertexInstanceColors();
+        TVertexInstanceAttributesRef<FVector2f> UVs = Attributes.GetVertexInstanceUVs();
+
+        VertexIDMap.Reset();
+        VertexIDMap.Reserve(NumTriangles);
+
+        for (int32 SortedIndex = FirstTriangle; SortedIndex < FirstTriangle + NumTriangles; ++SortedIndex)
+        {
+            const int32 Tri = SortedTriangles[SortedIndex];
+            TArray<FVertexInstanceID, TInlineAllocator<3>> TriangleVertexInstances;
+
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const uint32 VertexIndex = Indices[Tri * 3 + Corner];
+
+                FVertexID* ExistingVertexID = VertexIDMap.Find(VertexIndex);
+                FVertexID VertexID = ExistingVertexID ? *ExistingVertexID : FVertexID(INDEX_NONE);
+                if (!ExistingVertexID)
+                {
+                    VertexID = MeshDescription.CreateVertex();
+                    VertexIDMap.Add(VertexIndex, VertexID);
+                    Positions[VertexID] = PositionBuffer.VertexPosition(VertexIndex);
+                }
+
+                FVertexInstanceID VertexInstanceID = MeshDescription.CreateVertexInstance(VertexID);
+                TriangleVertexInstances.Add(VertexInstanceID);
+
+                for (int32 UVChannel = 0; UVChannel < NumUVChannels; ++UVChannel)
+                {
+                    UVs.Set(VertexInstanceID, UVChannel, FVector2f(VertexBuffer.GetVertexUV(VertexIndex, UVChannel)));
+                }
+
+                if (bHasColors)
+                {
+                    Colors[VertexInstanceID] = FVector4f(FLinearColor(ColorBuffer.VertexColor(VertexIndex)));
+                }
+
+                Normals[VertexInstanceID] = FVector3f(VertexBuffer.VertexTangentZ(VertexIndex));
+                Tangents[VertexInstanceID] = FVector3f(VertexBuffer.VertexTangentX(VertexIndex));
+            }
+
+            MeshDescription.CreatePolygon(PolygonGroup, TriangleVertexInstances);
+        }
+    }
+}
+
+UStaticMesh* CreateEmptyStaticMeshFrom(
+    UStaticMesh* BaseMesh,
+    UObject* Outer,
+    FName Name,
+    EObjectFlags Flags)
+{
+    // Start from a fresh asset rather than a duplicate so the base mesh's source data is never copied,
+    // but carry over the asset settings a duplicate would keep
+    UStaticMesh* NewStaticMesh = NewObject<UStaticMesh>(Outer, Name, Flags);
+    NewStaticMesh->SetStaticMaterials(BaseMesh->GetStaticMaterials());
+    NewStaticMesh->NaniteSettings = BaseMesh->NaniteSettings;
+    NewStaticMesh->LODGroup = BaseMesh->LODGroup;
+    NewStaticMesh->SetLightMapResolution(BaseMesh->GetLightMapResolution());
+    NewStaticMesh->SetLightMapCoordinateIndex(BaseMesh->GetLightMapCoordinateIndex());
+    NewStaticMesh->bAllowCPUAccess = BaseMesh->bAllowCPUAccess;
+    NewStaticMesh->bGenerateMeshDistanceField = BaseMesh->bGenerateMeshDistanceField;
+
+    // LOD 0 receives the part geometry; reduction-generated LODs after it are rebuilt from LOD 0, imported ones cannot be split
+    for (int32 LodIndex = 0; LodIndex < BaseMesh->GetNumSourceModels(); ++LodIndex)
+    {
+        if (LodIndex > 0 && BaseMesh->IsMeshDescriptionValid(LodIndex))
+        {
+            break;
+        }
+
+        const FStaticMeshSourceModel& BaseSourceModel = BaseMesh->GetSourceModel(LodIndex);
+        FStaticMeshSourceModel& SourceModel = NewStaticMesh->AddSourceModel();
+        SourceModel.BuildSettings = BaseSourceModel.BuildSettings;
+        // The geometry comes from built LOD 0 data or is placed by the caller, so the base build scale is already applied
+        SourceModel.BuildSettings.BuildScale3D = FVector::OneVector;
+        SourceModel.ReductionSettings = BaseSourceModel.ReductionSettings;
+        SourceModel.ScreenSize = BaseSourceModel.ScreenSize;
+    }
+    if (NewStaticMesh->GetNumSourceModels() == 0)
+    {
+        NewStaticMesh->AddSourceModel();
+    }
+
+    // Collision settings carry over; simple shapes fit the whole base mesh rather than the part, so they are left out
+    NewStaticMesh->CreateBodySetup();
+    if (UBodySetup* BaseBodySetup = BaseMesh->GetBodySetup())
+    {
+        UBodySetup* BodySetup = NewStaticMesh->GetBodySetup();
+        BodySetup->CopyBodyPropertiesFrom(BaseBodySetup);
+        BodySetup->AggGeom.EmptyElements();
+        BodySetup->InvalidatePhysicsData();
+    }
+
+    return NewStaticMesh;
+}
+
+FString PrepareSplitFolder(UStaticMesh* BaseMesh)
+{
+    // Get base mesh details
+    FString BaseMeshName = BaseMesh->GetName();
+    FString BaseMeshPath = FPackageName::GetLongPackagePath(BaseMesh->GetOutermost()->GetName());
+    FString DestinationFolder = BaseMeshPath + TEXT("/") + BaseMeshName;
+    FString SplitFolderPath = DestinationFolder + TEXT("/Split");
+
+    // Load the Asset Registry and Asset Tools
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+    AssetRegistryModule.Get().AddPath(SplitFolderPath);
+
+    // Move the original static mesh asset to the new destination folder
+    FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
+
+    FAssetRenameData RenameData(BaseMesh, DestinationFolder, BaseMeshName);
+    TArray<FAssetRenameData> RenameDataArray;
+    RenameDataArray.Add(RenameData);
+
+    bool bRenameSuccess = AssetToolsModule.Get().RenameAssets(RenameDataArray);
+    if (!bRenameSuccess)
+    {
+        //UE_LOG(LogEZSplit, Warning, TEXT("Failed to move original static mesh: %s to %s"), *OriginalAssetPath, *NewBaseMeshPath);
+    }
+    else
+    {
+        //UE_LOG(LogEZSplit, Log, TEXT("Moved original static mesh: %s to %s"), *OriginalAssetPath, *NewBaseMeshPath);
+    }
+
+    return SplitFolderPath;
+}
+
 void HandleSplitMeshPlacement(
     AActor* OriginalActor,
+    const FTransform& PartTransform,
     const TArray<UStaticMesh*>& SplitMeshes,
     const FString& BaseMeshName)
 {
@@ -417,11 +914,11 @@ void HandleSplitMeshPlacement(
         return;
     }
 
-    // Get the world and original actor's folder path
-    UWorld* World = OriginalActor->GetWorld();
-    if (!World)
+    // Get the level and original actor's folder path; the parts stay in the original actor's level, not the current one
+    ULevel* Level = OriginalActor->GetLevel();
+    if (!Level || !Level->GetWorld())
     {
-        UE_LOG(LogEZSplit, Warning, TEXT("HandleSplitMeshPlacement: No valid world!"));
+        UE_LOG(LogEZSplit, Warning, TEXT("HandleSplitMeshPlacement: No valid level!"));
         return;
     }
 
@@ -431,33 +928,79 @@ void HandleSplitMeshPlacement(
     // Delete the original actor
     OriginalActor->Destroy();
 
-    // Spawn new actors for each split mesh
-    for (UStaticMesh* SplitMesh : SplitMeshes)
+    // Split meshes keep the original mesh's local space, so the parts go where the split component was
+    TArray<AStaticMeshActor*> NewActors = SpawnStaticMeshActorsBatched(Level, SplitMeshes, PartTransform, FName(*NewFolderPath));
+
+    // Refresh the outliner and viewports once for the whole batch
+    if (GEditor)
     {
-        if (!SplitMesh) continue;
+        GEditor->BroadcastLevelActorListChanged();
+        GEditor->RedrawLevelEditingViewports();
+    }
 
-        // Spawn a new static mesh actor
-        AStaticMeshActor* NewActor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator);
-        if (!NewActor) continue;
+    // Log completion
+    UE_LOG(LogEZSplit, Log, TEXT("Successfully placed %d split mesh actors under folder: %s"), NewActors.Num(), *NewFolderPath);
+}
+
+TArray<AStaticMeshActor*> SpawnStaticMeshActorsBatched(
+    ULevel* Level,
+    const TArray<UStaticMesh*>& Meshes,
+    const FTransform& Transform,
+    const FName& FolderPath)
+{
+    TArray<AStaticMeshActor*> NewActors;
+    UWorld* World = Level ? Level->GetWorld() : nullptr;
+    if (!World || Meshes.Num() == 0)
+    {
+        UE_LOG(LogEZSplit, Warning, TEXT("SpawnStaticMeshActorsBatched: Invalid input!"));
+        return NewActors;
+    }
 
-        // Assign the split mesh to the new actor
-        UStaticMeshComponent* MeshComponent = NewActor->GetStaticMeshComponent();
-        if (MeshComponent)
+    NewActors.Reserve(Meshes.Num());
+
+    FScopedSlowTask SlowTask(Meshes.Num(), FText::FromString("Placing split meshes..."));
+    SlowTask.MakeDialogDelayed(1.0f);
+
+    for (UStaticMesh* Mesh : Meshes)
+    {
+        SlowTask.EnterProgressFrame();
+        if (!Mesh) continue;
+
+        // Name the actor after its label up front so the label needs no rename
+        FName ActorName = Mesh->GetFName();
+        if (StaticFindObjectFast(nullptr, Level, ActorName))
         {
-            MeshComponent->SetStaticMesh(SplitMesh);
+            ActorName = MakeUniqueObjectName(Level, AStaticMeshActor::StaticClass(), ActorName);
         }
 
-        // Place the new actor in the /Split folder
-        NewActor->SetFolderPath(FName(*NewFolderPath));
-        NewActor->SetActorLabel(SplitMesh->GetName());
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Name = ActorName;
+        SpawnParams.OverrideLevel = Level;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        SpawnParams.InitialActorLabel = Mesh->GetName();
+
+        // Runs before PostSpawnInitialize registers the components, so the mesh costs no extra render state or physics rebuild
+        SpawnParams.CustomPreSpawnInitalization = [Mesh, &FolderPath](AActor* Actor)
+            {
+                AStaticMeshActor* StaticMeshActor = CastChecked<AStaticMeshActor>(Actor);
+                if (UStaticMeshComponent* MeshComponent = StaticMeshActor->GetStaticMeshComponent())
+                {
+                    MeshComponent->SetStaticMesh(Mesh);
+                }
+                StaticMeshActor->SetFolderPath(FolderPath);
+            };
+
+        AStaticMeshActor* NewActor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Transform, SpawnParams);
+        if (!NewActor) continue;
 
-        UE_LOG(LogEZSplit, Log, TEXT("Spawned new actor: %s in folder %s"), *SplitMesh->GetName(), *NewFolderPath);
+        NewActor->MarkPackageDirty();
+        NewActors.Add(NewActor);
     }
 
-    // Log completion
-    UE_LOG(LogEZSplit, Log, TEXT("Successfully handled split mesh placement under folder: %s"), *NewFolderPath);
-}
+    UE_LOG(LogEZSplit, Log, TEXT("Spawned %d actors in folder %s"), NewActors.Num(), *FolderPath.ToString());
 
+    return NewActors;
+}
 
 // Merge
 void MergeSelectedStaticMeshes()
@@ -485,6 +1028,184 @@ void MergeSelectedStaticMeshes()
         return;
     }
 
+    // A failed merge leaves the actors in place, still using their meshes
+    if (MergeStaticMeshComponents(ComponentsToMerge, SelectedActors))
+    {
+        DeleteMergedSourceMeshes(ComponentsToMerge);
+    }
+}
+
+void MergeSelectedStaticMeshesClustered()
+{
+    // Get selected actors
+    TArray<AActor*> SelectedActors;
+    GEditor->GetSelectedActors()->GetSelectedObjects<AActor>(SelectedActors);
+
+    // Collect static mesh components
+    TArray<UPrimitiveComponent*> ComponentsToMerge;
+    for (AActor* Actor : SelectedActors)
+    {
+        if (AStaticMeshActor* StaticMeshActor = Cast<AStaticMeshActor>(Actor))
+        {
+            UStaticMeshComponent* StaticMeshComponent = StaticMeshActor->GetStaticMeshComponent();
+            if (StaticMeshComponent && StaticMeshComponent->GetStaticMesh())
+            {
+                ComponentsToMerge.Add(StaticMeshComponent);
+            }
+        }
+    }
+
+    if (ComponentsToMerge.Num() < 2)
+    {
+        UE_LOG(LogEZSplit, Warning, TEXT("Select at least two static mesh actors to merge."));
+        return;
+    }
+
+    TArray<TArray<UPrimitiveComponent*>> Clusters;
+    ClusterComponentsForMerge(
+        ComponentsToMerge,
+        CVarEZSplitMergeClusterMaxTriangles.GetValueOnGameThread(),
+        CVarEZSplitMergeClusterMaxExtent.GetValueOnGameThread(),
+        Clusters);
+
+    UE_LOG(LogEZSplit, Log, TEXT("Partitioned %d components into %d merge clusters."), ComponentsToMerge.Num(), Clusters.Num());
+
+    FScopedSlowTask SlowTask(Clusters.Num(), FText::FromString("Merging clusters..."));
+    SlowTask.MakeDialog();
+
+    // MeshMergeUtilities creates assets and bakes materials, so the clusters are merged one after another on the game thread
+    int32 NumMerged = 0;
+    TArray<UPrimitiveComponent*> MergedComponents;
+    for (const TArray<UPrimitiveComponent*>& Cluster : Clusters)
+    {
+        SlowTask.EnterProgressFrame();
+
+        // A lone component has nothing to merge with and keeps its actor
+        if (Cluster.Num() < 2)
+        {
+            continue;
+        }
+
+        TArray<AActor*> ClusterActors;
+        ClusterActors.Reserve(Cluster.Num());
+        for (UPrimitiveComponent* Component : Cluster)
+        {
+            ClusterActors.Add(Component->GetOwner());
+        }
+
+        if (MergeStaticMeshComponents(Cluster, ClusterActors))
+        {
+            MergedComponents.Append(Cluster);
+            ++NumMerged;
+        }
+    }
+
+    // Components of lone or failed clusters keep their actors, so any mesh they still use stays
+    const TSet<UPrimitiveComponent*> MergedComponentSet(MergedComponents);
+    TSet<UStaticMesh*> MeshesInUse;
+    for (UPrimitiveComponent* Component : ComponentsToMerge)
+    {
+        if (!MergedComponentSet.Contains(Component))
+        {
+            MeshesInUse.Add(CastChecked<UStaticMeshComponent>(Component)->GetStaticMesh());
+        }
+    }
+    MergedComponents.RemoveAll([&MeshesInUse](UPrimitiveComponent* Component) {
+        return MeshesInUse.Contains(CastChecked<UStaticMeshComponent>(Component)->GetStaticMesh());
+        });
+
+    // Previously merged inputs may be shared between clusters, so they are only removed once every cluster is done
+    DeleteMergedSourceMeshes(MergedComponents);
+
+    UE_LOG(LogEZSplit, Log, TEXT("Created %d clustered merged meshes."), NumMerged);
+}
+
+void ClusterComponentsForMerge(
+    const TArray<UPrimitiveComponent*>& Components,
+    int32 MaxTriangles,
+    float MaxExtent,
+    TArray<TArray<UPrimitiveComponent*>>& OutClusters)
+{
+    struct FClusterItem
+    {
+        UPrimitiveComponent* Component;
+        FBox Bounds;
+        int32 NumTriangles;
+    };
+
+    TArray<FClusterItem> Items;
+    Items.Reserve(Components.Num());
+    for (UPrimitiveComponent* Component : Components)
+    {
+        int32 NumTriangles = 0;
+        if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component))
+        {
+            if (UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh())
+            {
+                NumTriangles = StaticMesh->GetNumTriangles(0);
+            }
+        }
+        Items.Add({ Component, Component->Bounds.GetBox(), NumTriangles });
+    }
+
+    // Top-down bounds BVH: split a range at its triangle-weighted median along the longest centroid axis
+    // until every leaf fits both budgets
+    TArray<TPair<int32, int32>> Ranges;
+    Ranges.Emplace(0, Items.Num());
+    while (Ranges.Num() > 0)
+    {
+        const TPair<int32, int32> Range = Ranges.Pop();
+        const int32 Begin = Range.Key;
+        const int32 End = Range.Value;
+
+        FBox Bounds(ForceInit);
+        FBox CenterBounds(ForceInit);
+        int64 NumTriangles = 0;
+        for (int32 ItemIndex = Begin; ItemIndex < End; ++ItemIndex)
+        {
+            Bounds += Items[ItemIndex].Bounds;
+            CenterBounds += Items[ItemIndex].Bounds.GetCenter();
+            NumTriangles += Items[ItemIndex].NumTriangles;
+        }
+
+        const bool bWithinTriangles = MaxTriangles <= 0 || NumTriangles <= MaxTriangles;
+        const bool bWithinExtent = MaxExtent <= 0.0f || Bounds.GetSize().GetMax() <= MaxExtent;
+        if (End - Begin == 1 || (bWithinTriangles && bWithinExtent))
+        {
+            TArray<UPrimitiveComponent*>& Cluster = OutClusters.AddDefaulted_GetRef();
+            Cluster.Reserve(End - Begin);
+            for (int32 ItemIndex = Begin; ItemIndex < End; ++ItemIndex)
+            {
+                Cluster.Add(Items[ItemIndex].Component);
+            }
+            continue;
+        }
+
+        const FVector CenterSize = CenterBounds.GetSize();
+        const int32 Axis = (CenterSize.X >= CenterSize.Y && CenterSize.X >= CenterSize.Z) ? 0 : (CenterSize.Y >= CenterSize.Z ? 1 : 2);
+        Algo::Sort(MakeArrayView(Items.GetData() + Begin, End - Begin), [Axis](const FClusterItem& A, const FClusterItem& B)
+            {
+                return A.Bounds.GetCenter()[Axis] < B.Bounds.GetCenter()[Axis];
+            });
+
+        // Balance the halves by triangles, keeping at least one component on each side
+        int32 Mid = Begin + 1;
+        int64 LeftTriangles = Items[Begin].NumTriangles;
+        while (Mid < End - 1 && LeftTriangles * 2 < NumTriangles)
+        {
+            LeftTriangles += Items[Mid].NumTriangles;
+            ++Mid;
+        }
+
+        Ranges.Emplace(Mid, End);
+        Ranges.Emplace(Begin, Mid);
+    }
+}
+
+UStaticMesh* MergeStaticMeshComponents(
+    const TArray<UPrimitiveComponent*>& ComponentsToMerge,
+    const TArray<AActor*>& ActorsToReplace)
+{
     // Get the path of the first split mesh
     UStaticMesh* FirstSplitMesh = nullptr;
     for (UPrimitiveComponent* Component : ComponentsToMerge)
@@ -499,7 +1220,7 @@ void MergeSelectedStaticMeshes()
     if (!FirstSplitMesh)
     {
         UE_LOG(LogEZSplit, Warning, TEXT("No valid static mesh found for merging."));
-        return;
+        return nullptr;
     }
 
     FString FirstMeshPath = FPackageName::GetLongPackagePath(FirstSplitMesh->GetOutermost()->GetName());
@@ -586,7 +1307,7 @@ void MergeSelectedStaticMeshes()
         SavePackage(MergedStaticMesh->GetOutermost(), MergedFileName);
 
         // Handle placement of the merged mesh in the level
-        HandleMergedMeshPlacement(MergedStaticMesh, SelectedActors);
+        HandleMergedMeshPlacement(MergedStaticMesh, ActorsToReplace);
 
 
         UE_LOG(LogEZSplit, Log, TEXT("Merged static mesh created at %s"), *MergedStaticMesh->GetPathName());
@@ -596,23 +1317,36 @@ void MergeSelectedStaticMeshes()
         UE_LOG(LogEZSplit, Error, TEXT("Failed to merge static meshes."));
     }
 
-    for (UPrimitiveComponent* Component : ComponentsToMerge)
+    return MergedStaticMesh;
+}
+
+void DeleteMergedSourceMeshes(const TArray<UPrimitiveComponent*>& MergedComponents)
+{
+    // Inputs that were themselves merge results are replaced by the new merged mesh
+    TArray<UObject*> Objects;
+    for (UPrimitiveComponent* Component : MergedComponents)
     {
         if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component))
         {
             UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
+            if (!StaticMesh)
+            {
+                continue;
+            }
 
             FString Path = FPackageName::GetLongPackagePath(StaticMesh->GetOutermost()->GetName());
 
-            TArray<UObject*> Objects;
-
             if (Path.EndsWith("/Merged"))
             {
-                Objects.Add(StaticMesh);
-                ObjectTools::DeleteObjects(Objects, /*bShowConfirmation=*/false);
+                Objects.AddUnique(StaticMesh);
             }
         }
     }
+
+    if (Objects.Num() > 0)
+    {
+        ObjectTools::DeleteObjects(Objects, /*bShowConfirmation=*/false);
+    }
 }
 
 void HandleMergedMeshPlacement(
@@ -674,6 +1408,204 @@ void HandleMergedMeshPlacement(
     UE_LOG(LogEZSplit, Log, TEXT("Placed merged mesh actor: %s in folder: %s"), *MergedMesh->GetName(), *NewFolderPath);
 }
 
+// Library
+TArray<UStaticMesh*> UEZSplitLibrary::SplitStaticMeshTransient(UStaticMesh* SourceMesh)
+{
+    if (!SourceMesh || !SourceMesh->GetRenderData() || SourceMesh->GetRenderData()->LODResources.Num() == 0)
+    {
+        UE_LOG(LogEZSplit, Warning, TEXT("SplitStaticMeshTransient: SourceMesh has no RenderData!"));
+        return TArray<UStaticMesh*>();
+    }
+
+    // The streaming budget still bounds the part geometry unpacked at once; the parts themselves are the result, so they all stay loaded
+    const int64 StreamingBudgetBytes = int64(CVarEZSplitStreamingBudgetMB.GetValueOnGameThread()) * 1024 * 1024;
+    const int64 BatchBudgetBytes = StreamingBudgetBytes > 0 ? StreamingBudgetBytes : MAX_int64;
+
+    FString BaseMeshName = SourceMesh->GetName();
+
+    auto CreatePartMesh = [&SourceMesh, &BaseMeshName](int32 PartIndex) -> UStaticMesh* {
+        FName NewMeshName = MakeUniqueObjectName(GetTransientPackage(), UStaticMesh::StaticClass(), FName(*FString::Printf(TEXT("%s_%d"), *BaseMeshName, PartIndex)));
+        return CreateEmptyStaticMeshFrom(SourceMesh, GetTransientPackage(), NewMeshName, RF_Transient);
+        };
+
+    TArray<UStaticMesh*> SplitMeshes;
+    BuildSplitStaticMeshes(SourceMesh, BatchBudgetBytes, CreatePartMesh, [&SplitMeshes](const TArray<UStaticMesh*>& BatchMeshes) {
+        SplitMeshes.Append(BatchMeshes);
+        });
+    return SplitMeshes;
+}
+
+TArray<UStaticMesh*> UEZSplitLibrary::SplitStaticMeshComponentTransient(UStaticMeshComponent* Component)
+{
+    if (!Component)
+    {
+        UE_LOG(LogEZSplit, Warning, TEXT("SplitStaticMeshComponentTransient: Component is null!"));
+        return TArray<UStaticMesh*>();
+    }
+
+    return SplitStaticMeshTransient(Component->GetStaticMesh());
+}
+
+// Shared by the mesh and component merges. SlotMaterials, when given, holds the material used for each
+// static material slot of the matching mesh (e.g. a component's overrides); otherwise the mesh's own materials are used.
+static UStaticMesh* MergeStaticMeshesTransientWithMaterials(
+    const TArray<UStaticMesh*>& Meshes,
+    const TArray<FTransform>& Transforms,
+    const TArray<TArray<UMaterialInterface*>>& SlotMaterials)
+{
+    if (Transforms.Num() != 0 && Transforms.Num() != Meshes.Num())
+    {
+        UE_LOG(LogEZSplit, Warning, TEXT("MergeStaticMeshesTransient: Expected %d transforms, got %d."), Meshes.Num(), Transforms.Num());
+        return nullptr;
+    }
+
+    FMeshDescription MergedDescription;
+    FStaticMeshAttributes MergedAttributes(MergedDescription);
+    MergedAttributes.Register();
+
+    // One merged material slot, and polygon group, per distinct material
+    TArray<FStaticMaterial> MergedMaterials;
+    TArray<FPolygonGroupID> MergedPolygonGroups;
+    UStaticMesh* FirstMesh = nullptr;
+
+    for (int32 MeshIndex = 0; MeshIndex < Meshes.Num(); ++MeshIndex)
+    {
+        UStaticMesh* Mesh = Meshes[MeshIndex];
+        if (!Mesh)
+        {
+            continue;
+        }
+
+        const FMeshDescription* SourceDescription = Mesh->GetMeshDescription(0);
+        if (!SourceDescription)
+        {
+            UE_LOG(LogEZSplit, Warning, TEXT("MergeStaticMeshesTransient: No MeshDescription found in %s"), *Mesh->GetName());
+            continue;
+        }
+
+        if (!FirstMesh)
+        {
+            FirstMesh = Mesh;
+        }
+
+        const TArray<FStaticMaterial>& SourceMaterials = Mesh->GetStaticMaterials();
+        const TArray<UMaterialInterface*>* SourceSlotMaterials = SlotMaterials.IsValidIndex(MeshIndex) ? &SlotMaterials[MeshIndex] : nullptr;
+
+        FStaticMeshOperations::FAppendSettings AppendSettings;
+        // MeshDescriptions are unscaled source data, so each mesh's own build scale goes into its placement;
+        // the merged mesh is built at unit scale
+        const FVector BuildScale = Mesh->GetNumSourceModels() > 0 ? Mesh->GetSourceModel(0).BuildSettings.BuildScale3D : FVector::OneVector;
+        const FTransform PlacementTransform = Transforms.IsValidIndex(MeshIndex) ? Transforms[MeshIndex] : FTransform::Identity;
+        AppendSettings.MeshTransform = FTransform(FQuat::Identity, FVector::ZeroVector, BuildScale) * PlacementTransform;
+        AppendSettings.PolygonGroupsDelegate = FAppendPolygonGroupsDelegate::CreateLambda(
+            [&SourceMaterials, SourceSlotMaterials, &MergedMaterials, &MergedPolygonGroups](const FMeshDescription& SourceMesh, FMeshDescription& TargetMesh, PolygonGroupMap& RemapPolygonGroups)
+            {
+                FStaticMeshConstAttributes SourceAttributes(SourceMesh);
+                TPolygonGroupAttributesConstRef<FName> SourceSlotNames = SourceAttributes.GetPolygonGroupMaterialSlotNames();
+
+                FStaticMeshAttributes TargetAttributes(TargetMesh);
+                TPolygonGroupAttributesRef<FName> TargetSlotNames = TargetAttributes.GetPolygonGroupMaterialSlotNames();
+
+                for (FPolygonGroupID SourceGroup : SourceMesh.PolygonGroups().GetElementIDs())
+                {
+                    const FName SlotName = SourceSlotNames[SourceGroup];
+                    int32 SourceMaterialIndex = SourceMaterials.IndexOfByPredicate([&SlotName](const FStaticMaterial& Material) {
+                        return Material.ImportedMaterialSlotName == SlotName;
+                        });
+                    if (SourceMaterialIndex == INDEX_NONE && SourceMaterials.IsValidIndex(SourceGroup.GetValue()))
+                    {
+                        SourceMaterialIndex = SourceGroup.GetValue();
+                    }
+                    UMaterialInterface* Material = nullptr;
+                    if (SourceSlotMaterials && SourceSlotMaterials->IsValidIndex(SourceMaterialIndex))
+                    {
+                        Material = (*SourceSlotMaterials)[SourceMaterialIndex];
+                    }
+                    else if (SourceMaterials.IsValidIndex(SourceMaterialIndex))
+                    {
+                        Material = SourceMaterials[SourceMaterialIndex].MaterialInterface;
+                    }
+
+                    int32 MergedMaterialIndex = MergedMaterials.IndexOfByPredicate([Material](const FStaticMaterial& MergedMaterial) {
+                        return MergedMaterial.MaterialInterface == Material;
+                        });
+                    if (MergedMaterialIndex == INDEX_NONE)
+                    {
+                        FName MergedSlotName = SlotName.IsNone() ? FName(TEXT("MergedMaterial")) : SlotName;
+                        if (MergedMaterials.ContainsByPredicate([&MergedSlotName](const FStaticMaterial& MergedMaterial) { return MergedMaterial.ImportedMaterialSlotName == MergedSlotName; }))
+                        {
+                            MergedSlotName = FName(MergedSlotName, MergedMaterials.Num());
+                        }
+
+                        FPolygonGroupID MergedGroup = TargetMesh.CreatePolygonGroup();
+                        TargetSlotNames[MergedGroup] = MergedSlotName;
+
+                        MergedMaterialIndex = MergedMaterials.Add(FStaticMaterial(Material, MergedSlotName, MergedSlotName));
+                        MergedPolygonGroups.Add(MergedGroup);
+                    }
+
+                    RemapPolygonGroups.Add(SourceGroup, MergedPolygonGroups[MergedMaterialIndex]);
+                }
+            });
+
+        FStaticMeshOperations::AppendMeshDescription(*SourceDescription, MergedDescription, AppendSettings);
+    }
+
+    if (!FirstMesh)
+    {
+        UE_LOG(LogEZSplit, Warning, TEXT("MergeStaticMeshesTransient: No valid static mesh found for merging."));
+        return nullptr;
+    }
+
+    FName MergedMeshName = MakeUniqueObjectName(GetTransientPackage(), UStaticMesh::StaticClass(), FName(*(FirstMesh->GetName() + TEXT("_Merged"))));
+    UStaticMesh* MergedStaticMesh = CreateEmptyStaticMeshFrom(FirstMesh, GetTransientPackage(), MergedMeshName, RF_Transient);
+    MergedStaticMesh->SetStaticMaterials(MergedMaterials);
+
+    MergedStaticMesh->CreateMeshDescription(0, MoveTemp(MergedDescription));
+    MergedStaticMesh->CommitMeshDescription(0);
+    MergedStaticMesh->CreateBodySetup();
+    MergedStaticMesh->SetLightingGuid();
+    MergedStaticMesh->Build(/*bInSilent=*/true);
+
+    return MergedStaticMesh;
+}
+
+UStaticMesh* UEZSplitLibrary::MergeStaticMeshesTransient(const TArray<UStaticMesh*>& Meshes, const TArray<FTransform>& Transforms)
+{
+    return MergeStaticMeshesTransientWithMaterials(Meshes, Transforms, TArray<TArray<UMaterialInterface*>>());
+}
+
+UStaticMesh* UEZSplitLibrary::MergeStaticMeshComponentsTransient(const TArray<UStaticMeshComponent*>& Components)
+{
+    TArray<UStaticMesh*> Meshes;
+    TArray<FTransform> Transforms;
+    TArray<TArray<UMaterialInterface*>> SlotMaterials;
+    Meshes.Reserve(Components.Num());
+    Transforms.Reserve(Components.Num());
+    SlotMaterials.Reserve(Components.Num());
+
+    for (UStaticMeshComponent* Component : Components)
+    {
+        UStaticMesh* Mesh = Component ? Component->GetStaticMesh() : nullptr;
+        if (!Mesh)
+        {
+            continue;
+        }
+
+        Meshes.Add(Mesh);
+        Transforms.Add(Component->GetComponentTransform());
+
+        // GetMaterial resolves the component's override for each slot, falling back to the mesh's material
+        TArray<UMaterialInterface*>& Materials = SlotMaterials.AddDefaulted_GetRef();
+        for (int32 SlotIndex = 0; SlotIndex < Mesh->GetStaticMaterials().Num(); ++SlotIndex)
+        {
+            Materials.Add(Component->GetMaterial(SlotIndex));
+        }
+    }
+
+    return MergeStaticMeshesTransientWithMaterials(Meshes, Transforms, SlotMaterials);
+}
+
 // Save
 void SavePackage(UPackage* Package, const FString& FileName)
 {
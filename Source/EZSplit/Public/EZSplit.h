@@ -6,6 +6,13 @@
 #include "Modules/ModuleManager.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "StaticMeshDescription.h"
+#include "EZSplit.generated.h"
+
+class AStaticMeshActor;
+class ULevel;
+class UStaticMesh;
+class UStaticMeshComponent;
+class FIndexArrayView;
 
 class FEZSplitModule : public IModuleInterface
 {
@@ -18,6 +25,35 @@ public:
 	void AddMenuEntry(FMenuBuilder& MenuBuilder);
 	void OnSplitMeshButtonClicked();
 	void OnMergeMeshButtonClicked();
+	void OnMergeClusteredMeshButtonClicked();
+};
+
+/**
+ * Scriptable split/merge that works on meshes and components directly.
+ * Results are transient static meshes: nothing is renamed, saved or spawned, so operations can be chained in memory.
+ */
+UCLASS()
+class EZSPLIT_API UEZSplitLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Splits LOD 0 of a static mesh into one transient static mesh per loose part. */
+	UFUNCTION(BlueprintCallable, Category = "EZSplit")
+	static TArray<UStaticMesh*> SplitStaticMeshTransient(UStaticMesh* SourceMesh);
+
+	/** Splits the static mesh of a component into one transient static mesh per loose part. */
+	UFUNCTION(BlueprintCallable, Category = "EZSplit")
+	static TArray<UStaticMesh*> SplitStaticMeshComponentTransient(UStaticMeshComponent* Component);
+
+	/** Merges static meshes into one transient static mesh, placing each by the matching transform (identity if none given). Uses each mesh's own materials. */
+	UFUNCTION(BlueprintCallable, Category = "EZSplit")
+	static UStaticMesh* MergeStaticMeshesTransient(const TArray<UStaticMesh*>& Meshes, const TArray<FTransform>& Transforms);
+
+	/** Merges the static meshes of components into one transient static mesh in world space, using each component's material overrides. */
+	UFUNCTION(BlueprintCallable, Category = "EZSplit")
+	static UStaticMesh* MergeStaticMeshComponentsTransient(const TArray<UStaticMeshComponent*>& Components);
 };
 
 // Split
@@ -39,14 +75,82 @@ TArray<UStaticMesh*> CreateNewStaticMeshes(
 	const TArray<FColor>& Colors,
 	const TArray<TArray<FVector2D>>& UVChannels);
 
+// Streaming split: labels parts with an index-only pass, then builds, saves and unloads them in batches
+// that stay under BatchBudgetBytes. The saved parts are loaded back for placement.
+void SplitMeshStreaming(AActor* Actor, const FTransform& PartTransform, UStaticMesh* BaseMesh, int64 BatchBudgetBytes);
+
+// Splits LOD 0 of BaseMesh into one mesh per loose part, batch by batch. CreatePartMesh supplies the empty
+// mesh for each part (or null to skip it). OnBatchBuilt receives each batch once its render data is built and
+// decides whether to keep or release it; nothing else holds on to the parts. Returns the number of parts built.
+int32 BuildSplitStaticMeshes(
+	UStaticMesh* BaseMesh,
+	int64 BatchBudgetBytes,
+	TFunctionRef<UStaticMesh*(int32 PartIndex)> CreatePartMesh,
+	TFunctionRef<void(const TArray<UStaticMesh*>& BatchMeshes)> OnBatchBuilt);
+
+int32 LabelConnectedComponents(
+	const FIndexArrayView& Indices,
+	int32 NumVertices,
+	TArray<int32>& OutVertexComponents,
+	TArray<int32>& OutComponentTriangleCounts);
+
+// Groups triangle indices by part: the triangles of part C are
+// OutSortedTriangles[OutComponentTriangleOffsets[C], OutComponentTriangleOffsets[C + 1])
+void SortTrianglesByComponent(
+	const FIndexArrayView& Indices,
+	const TArray<int32>& VertexComponents,
+	const TArray<int32>& ComponentTriangleCounts,
+	TArray<int32>& OutComponentTriangleOffsets,
+	TArray<int32>& OutSortedTriangles);
+
+void BuildComponentMeshDescriptions(
+	UStaticMesh* BaseMesh,
+	const TArray<int32>& ComponentTriangleOffsets,
+	const TArray<int32>& SortedTriangles,
+	int32 FirstComponent,
+	int32 NumComponents,
+	TArray<FMeshDescription>& OutMeshDescriptions);
+
+UStaticMesh* CreateEmptyStaticMeshFrom(
+	UStaticMesh* BaseMesh,
+	UObject* Outer,
+	FName Name,
+	EObjectFlags Flags);
+
+FString PrepareSplitFolder(UStaticMesh* BaseMesh);
+
+// Replaces OriginalActor with one actor per split mesh in the same level, each placed at PartTransform,
+// the world transform of the component that was split
 void HandleSplitMeshPlacement(
 	AActor* OriginalActor,
+	const FTransform& PartTransform,
 	const TArray<UStaticMesh*>& SplitMeshes,
 	const FString& BaseMeshName);
 
+TArray<AStaticMeshActor*> SpawnStaticMeshActorsBatched(
+	ULevel* Level,
+	const TArray<UStaticMesh*>& Meshes,
+	const FTransform& Transform,
+	const FName& FolderPath);
+
 // Merge
 void MergeSelectedStaticMeshes();
 
+// Partitions the selection with a bounds BVH and merges each cluster separately
+void MergeSelectedStaticMeshesClustered();
+
+void ClusterComponentsForMerge(
+	const TArray<UPrimitiveComponent*>& Components,
+	int32 MaxTriangles,
+	float MaxExtent,
+	TArray<TArray<UPrimitiveComponent*>>& OutClusters);
+
+UStaticMesh* MergeStaticMeshComponents(
+	const TArray<UPrimitiveComponent*>& ComponentsToMerge,
+	const TArray<AActor*>& ActorsToReplace);
+
+void DeleteMergedSourceMeshes(const TArray<UPrimitiveComponent*>& MergedComponents);
+
 void HandleMergedMeshPlacement(
 	UStaticMesh* MergedMesh,
 	const TArray<AActor*>& SelectedActors);
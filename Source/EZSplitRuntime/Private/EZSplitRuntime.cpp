@@ -0,0 +1,814 @@
+#include "EZSplitRuntime.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
+#include "HAL/PlatformTime.h"
+#include "Logging/LogMacros.h"
+
+using namespace UE::Geometry;
+
+DEFINE_LOG_CATEGORY_STATIC(LogEZSplitRuntime, Log, All);
+
+// Items processed between time checks in Tick
+static constexpr int32 EZSplitRuntimeChunkSize = 1024;
+
+void FEZSplitRuntimeModule::StartupModule()
+{
+    UE_LOG(LogEZSplitRuntime, Log, TEXT("EZSplitRuntime: StartupModule called."));
+}
+
+void FEZSplitRuntimeModule::ShutdownModule()
+{
+}
+
+// Copier
+template<typename OverlayType, typename TransformFunc>
+static void CopyOverlayTriangle(
+    const OverlayType& SourceOverlay,
+    OverlayType& TargetOverlay,
+    TArray<int32>& ElementRemap,
+    int32 SourceTriangleID,
+    int32 TargetTriangleID,
+    bool bFlipWinding,
+    TransformFunc&& TransformElement)
+{
+    if (!SourceOverlay.IsSetTriangle(SourceTriangleID))
+    {
+        return;
+    }
+
+    const FIndex3i SourceElements = SourceOverlay.GetTriangle(SourceTriangleID);
+    FIndex3i TargetElements;
+    for (int32 Corner = 0; Corner < 3; ++Corner)
+    {
+        int32& TargetElement = ElementRemap[SourceElements[Corner]];
+        if (TargetElement == IndexConstants::InvalidID)
+        {
+            TargetElement = TargetOverlay.AppendElement(TransformElement(SourceOverlay.GetElement(SourceElements[Corner])));
+        }
+        TargetElements[Corner] = TargetElement;
+    }
+    if (bFlipWinding)
+    {
+        Swap(TargetElements.B, TargetElements.C);
+    }
+
+    TargetOverlay.SetTriangle(TargetTriangleID, TargetElements);
+}
+
+void FEZDynamicMeshCopier::Reserve(int32 MaxVertices, int32 MaxElements)
+{
+    VertexRemap.Reserve(MaxVertices);
+    ColorRemap.Reserve(MaxElements);
+
+    UVRemaps.SetNum(FMath::Max(UVRemaps.Num(), 1));
+    for (TArray<int32>& Remap : UVRemaps)
+    {
+        Remap.Reserve(MaxElements);
+    }
+
+    NormalRemaps.SetNum(FMath::Max(NormalRemaps.Num(), 1));
+    for (TArray<int32>& Remap : NormalRemaps)
+    {
+        Remap.Reserve(MaxElements);
+    }
+}
+
+void FEZDynamicMeshCopier::SetSource(const FDynamicMesh3& InSource, int32 VertexIDLimit)
+{
+    Source = &InSource;
+
+    VertexRemap.Reset();
+    VertexRemap.SetNumUninitialized(VertexIDLimit == INDEX_NONE ? InSource.MaxVertexID() : VertexIDLimit);
+
+    const FDynamicMeshAttributeSet* Attributes = InSource.Attributes();
+
+    // Reset rather than reallocate, so inner tables keep their capacity between sources
+    const int32 NumUVLayers = Attributes ? Attributes->NumUVLayers() : 0;
+    if (UVRemaps.Num() < NumUVLayers)
+    {
+        UVRemaps.SetNum(NumUVLayers);
+    }
+    for (int32 Layer = 0; Layer < UVRemaps.Num(); ++Layer)
+    {
+        UVRemaps[Layer].Reset();
+        if (Layer < NumUVLayers)
+        {
+            UVRemaps[Layer].SetNumUninitialized(Attributes->GetUVLayer(Layer)->MaxElementID());
+        }
+    }
+
+    const int32 NumNormalLayers = Attributes ? Attributes->NumNormalLayers() : 0;
+    if (NormalRemaps.Num() < NumNormalLayers)
+    {
+        NormalRemaps.SetNum(NumNormalLayers);
+    }
+    for (int32 Layer = 0; Layer < NormalRemaps.Num(); ++Layer)
+    {
+        NormalRemaps[Layer].Reset();
+        if (Layer < NumNormalLayers)
+        {
+            NormalRemaps[Layer].SetNumUninitialized(Attributes->GetNormalLayer(Layer)->MaxElementID());
+        }
+    }
+
+    ColorRemap.Reset();
+    if (Attributes && Attributes->HasPrimaryColors())
+    {
+        ColorRemap.SetNumUninitialized(Attributes->PrimaryColors()->MaxElementID());
+    }
+}
+
+int32 FEZDynamicMeshCopier::GetNumRemapEntries() const
+{
+    int32 NumEntries = FMath::Max(VertexRemap.Num(), ColorRemap.Num());
+    for (const TArray<int32>& Remap : UVRemaps)
+    {
+        NumEntries = FMath::Max(NumEntries, Remap.Num());
+    }
+    for (const TArray<int32>& Remap : NormalRemaps)
+    {
+        NumEntries = FMath::Max(NumEntries, Remap.Num());
+    }
+    return NumEntries;
+}
+
+void FEZDynamicMeshCopier::ResetRemaps(int32 Begin, int32 End)
+{
+    auto ResetRange = [Begin, End](TArray<int32>& Remap) {
+        const int32 RangeEnd = FMath::Min(End, Remap.Num());
+        for (int32 Index = Begin; Index < RangeEnd; ++Index)
+        {
+            Remap[Index] = IndexConstants::InvalidID;
+        }
+        };
+
+    ResetRange(VertexRemap);
+    ResetRange(ColorRemap);
+    for (TArray<int32>& Remap : UVRemaps)
+    {
+        ResetRange(Remap);
+    }
+    for (TArray<int32>& Remap : NormalRemaps)
+    {
+        ResetRange(Remap);
+    }
+}
+
+int32 FEZDynamicMeshCopier::CopyTriangle(int32 SourceTriangleID, FDynamicMesh3& Target, const FTransformSRT3d* Transform)
+{
+    const FDynamicMesh3& SourceMesh = *Source;
+    const FIndex3i SourceTriangle = SourceMesh.GetTriangle(SourceTriangleID);
+
+    // A mirroring transform turns the faces inside out unless the winding is reversed too
+    const bool bFlipWinding = Transform && Transform->GetDeterminant() < 0.0;
+
+    FIndex3i TargetTriangle;
+    for (int32 Corner = 0; Corner < 3; ++Corner)
+    {
+        int32& TargetVertex = VertexRemap[SourceTriangle[Corner]];
+        if (TargetVertex == IndexConstants::InvalidID)
+        {
+            FVertexInfo VertexInfo;
+            SourceMesh.GetVertex(SourceTriangle[Corner], VertexInfo, SourceMesh.HasVertexNormals(), SourceMesh.HasVertexColors(), SourceMesh.HasVertexUVs());
+            if (Transform)
+            {
+                VertexInfo.Position = Transform->TransformPosition(VertexInfo.Position);
+                VertexInfo.Normal = FVector3f(Transform->TransformNormal(FVector3d(VertexInfo.Normal)).GetSafeNormal());
+            }
+            TargetVertex = Target.AppendVertex(VertexInfo);
+        }
+        TargetTriangle[Corner] = TargetVertex;
+    }
+    if (bFlipWinding)
+    {
+        Swap(TargetTriangle.B, TargetTriangle.C);
+    }
+
+    const int32 GroupID = SourceMesh.HasTriangleGroups() ? SourceMesh.GetTriangleGroup(SourceTriangleID) : 0;
+    const int32 TargetTriangleID = Target.AppendTriangle(TargetTriangle, GroupID);
+    if (TargetTriangleID < 0 || !SourceMesh.HasAttributes() || !Target.HasAttributes())
+    {
+        return TargetTriangleID;
+    }
+
+    const FDynamicMeshAttributeSet* SourceAttributes = SourceMesh.Attributes();
+    FDynamicMeshAttributeSet* TargetAttributes = Target.Attributes();
+
+    const int32 NumUVLayers = FMath::Min(SourceAttributes->NumUVLayers(), TargetAttributes->NumUVLayers());
+    for (int32 Layer = 0; Layer < NumUVLayers; ++Layer)
+    {
+        CopyOverlayTriangle(*SourceAttributes->GetUVLayer(Layer), *TargetAttributes->GetUVLayer(Layer), UVRemaps[Layer],
+            SourceTriangleID, TargetTriangleID, bFlipWinding, [](const FVector2f& UV) { return UV; });
+    }
+
+    // Layer 0 holds normals; further layers hold tangents and bitangents, which transform as vectors
+    const int32 NumNormalLayers = FMath::Min(SourceAttributes->NumNormalLayers(), TargetAttributes->NumNormalLayers());
+    for (int32 Layer = 0; Layer < NumNormalLayers; ++Layer)
+    {
+        CopyOverlayTriangle(*SourceAttributes->GetNormalLayer(Layer), *TargetAttributes->GetNormalLayer(Layer), NormalRemaps[Layer],
+            SourceTriangleID, TargetTriangleID, bFlipWinding, [Transform, Layer](const FVector3f& Normal) {
+                if (!Transform)
+                {
+                    return Normal;
+                }
+                const FVector3d Transformed = Layer == 0 ? Transform->TransformNormal(FVector3d(Normal)) : Transform->TransformVector(FVector3d(Normal));
+                return FVector3f(Transformed.GetSafeNormal());
+            });
+    }
+
+    if (SourceAttributes->HasPrimaryColors() && TargetAttributes->HasPrimaryColors())
+    {
+        CopyOverlayTriangle(*SourceAttributes->PrimaryColors(), *TargetAttributes->PrimaryColors(), ColorRemap,
+            SourceTriangleID, TargetTriangleID, bFlipWinding, [](const FVector4f& Color) { return Color; });
+    }
+
+    if (SourceAttributes->HasMaterialID() && TargetAttributes->HasMaterialID())
+    {
+        TargetAttributes->GetMaterialID()->SetValue(TargetTriangleID, SourceAttributes->GetMaterialID()->GetValue(SourceTriangleID));
+    }
+
+    const int32 NumPolygroupLayers = FMath::Min(SourceAttributes->NumPolygroupLayers(), TargetAttributes->NumPolygroupLayers());
+    for (int32 Layer = 0; Layer < NumPolygroupLayers; ++Layer)
+    {
+        TargetAttributes->GetPolygroupLayer(Layer)->SetValue(TargetTriangleID, SourceAttributes->GetPolygroupLayer(Layer)->GetValue(SourceTriangleID));
+    }
+
+    return TargetTriangleID;
+}
+
+// Split
+static int32 FindRoot(TArray<int32>& Parents, int32 Vertex)
+{
+    while (Parents[Vertex] != Vertex)
+    {
+        Parents[Vertex] = Parents[Parents[Vertex]];
+        Vertex = Parents[Vertex];
+    }
+    return Vertex;
+}
+
+// Removes triangles, then vertices, from the highest ID down, stopping once WorkLeft runs out.
+// Removed IDs go on the mesh's free lists rather than being released, so the storage is kept and
+// the next elements appended reuse the lowest IDs first. Pooled meshes are only filled right after being
+// emptied this way, so their IDs run from zero up to their element counts and the scan stops there,
+// however much storage the mesh holds. Returns true once the mesh is empty.
+static bool EmptyMeshKeepingCapacity(FDynamicMesh3& Mesh, int32& ScanID, int32& WorkLeft)
+{
+    const int32 NumVertexIDs = Mesh.VertexCount();
+    if (ScanID == INDEX_NONE)
+    {
+        ScanID = NumVertexIDs + Mesh.TriangleCount();
+    }
+
+    for (; ScanID > 0 && WorkLeft > 0; --WorkLeft)
+    {
+        --ScanID;
+        if (ScanID >= NumVertexIDs)
+        {
+            if (Mesh.IsTriangle(ScanID - NumVertexIDs))
+            {
+                Mesh.RemoveTriangle(ScanID - NumVertexIDs, false);
+            }
+        }
+        else if (Mesh.IsVertex(ScanID))
+        {
+            Mesh.RemoveVertex(ScanID);
+        }
+    }
+
+    if (ScanID > 0)
+    {
+        return false;
+    }
+    ScanID = INDEX_NONE;
+    return true;
+}
+
+template<typename OverlayType, typename ElementType>
+static void AppendPlaceholderElements(OverlayType& Overlay, const FDynamicMesh3& Mesh, const ElementType& Value)
+{
+    TArray<int32> VertexElements;
+    VertexElements.Init(IndexConstants::InvalidID, Mesh.MaxVertexID());
+    for (const int32 TriangleID : Mesh.TriangleIndicesItr())
+    {
+        const FIndex3i Triangle = Mesh.GetTriangle(TriangleID);
+        FIndex3i Elements;
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            int32& Element = VertexElements[Triangle[Corner]];
+            if (Element == IndexConstants::InvalidID)
+            {
+                Element = Overlay.AppendElement(Value);
+            }
+            Elements[Corner] = Element;
+        }
+        Overlay.SetTriangle(TriangleID, Elements);
+    }
+}
+
+// Grows Mesh to hold at least NumVertices vertices and NumTriangles triangles, with one overlay element
+// per vertex, by building a placeholder grid and emptying it again
+static void ReserveMeshCapacity(FDynamicMesh3& Mesh, int32 NumVertices, int32 NumTriangles)
+{
+    int32 ScanID = INDEX_NONE;
+    int32 WorkLeft = MAX_int32;
+    EmptyMeshKeepingCapacity(Mesh, ScanID, WorkLeft);
+
+    // Two triangles per grid cell, with extra rows when triangles outnumber vertices
+    const int32 RowSize = FMath::Max(2, FMath::CeilToInt(FMath::Sqrt(float(NumVertices))));
+    const int32 NumRows = FMath::Max3(2, FMath::DivideAndRoundUp(NumVertices, RowSize), FMath::DivideAndRoundUp(NumTriangles, 2 * (RowSize - 1)) + 1);
+
+    TArray<int32> GridVertices;
+    GridVertices.SetNumUninitialized(RowSize * NumRows);
+    for (int32 Index = 0; Index < GridVertices.Num(); ++Index)
+    {
+        GridVertices[Index] = Mesh.AppendVertex(FVector3d(double(Index % RowSize), double(Index / RowSize), 0.0));
+    }
+
+    for (int32 Cell = 0; Cell * 2 < NumTriangles; ++Cell)
+    {
+        const int32 Corner = Cell / (RowSize - 1) * RowSize + Cell % (RowSize - 1);
+        Mesh.AppendTriangle(GridVertices[Corner], GridVertices[Corner + 1], GridVertices[Corner + RowSize + 1]);
+        if (Cell * 2 + 1 < NumTriangles)
+        {
+            Mesh.AppendTriangle(GridVertices[Corner], GridVertices[Corner + RowSize + 1], GridVertices[Corner + RowSize]);
+        }
+    }
+
+    if (FDynamicMeshAttributeSet* Attributes = Mesh.Attributes())
+    {
+        for (int32 Layer = 0; Layer < Attributes->NumUVLayers(); ++Layer)
+        {
+            AppendPlaceholderElements(*Attributes->GetUVLayer(Layer), Mesh, FVector2f::ZeroVector);
+        }
+        for (int32 Layer = 0; Layer < Attributes->NumNormalLayers(); ++Layer)
+        {
+            AppendPlaceholderElements(*Attributes->GetNormalLayer(Layer), Mesh, FVector3f::ZAxisVector);
+        }
+        if (Attributes->HasPrimaryColors())
+        {
+            AppendPlaceholderElements(*Attributes->PrimaryColors(), Mesh, FVector4f(1.0f, 1.0f, 1.0f, 1.0f));
+        }
+    }
+
+    EmptyMeshKeepingCapacity(Mesh, ScanID, WorkLeft);
+}
+
+void FEZRuntimeMeshSplitter::Reserve(int32 MaxVertices, int32 MaxTriangles, int32 MaxParts, const FDynamicMesh3* AttributeLayout)
+{
+    // Parts from an earlier job are about to be emptied
+    Phase = EPhase::Idle;
+    NumParts = 0;
+    EmptyScanID = INDEX_NONE;
+
+    Parents.Reserve(MaxVertices);
+    RootHasTriangles.Reserve(MaxVertices);
+    BufferVertexIDs.Reserve(MaxVertices);
+    Copier.Reserve(MaxVertices, MaxVertices);
+    ReserveMeshCapacity(BufferMesh, MaxVertices, MaxTriangles);
+
+    while (PartPool.Num() < MaxParts)
+    {
+        PartPool.Add(MakeUnique<FDynamicMesh3>());
+    }
+
+    const int32 PartVertices = FMath::DivideAndRoundUp(MaxVertices, FMath::Max(MaxParts, 1));
+    const int32 PartTriangles = FMath::DivideAndRoundUp(MaxTriangles, FMath::Max(MaxParts, 1));
+    for (int32 PartIndex = 0; PartIndex < MaxParts; ++PartIndex)
+    {
+        FDynamicMesh3& Part = *PartPool[PartIndex];
+        if (AttributeLayout)
+        {
+            Part.EnableMeshComponents(AttributeLayout->GetComponentsFlags());
+            Part.EnableMatchingAttributes(*AttributeLayout, false, true);
+        }
+        ReserveMeshCapacity(Part, PartVertices, PartTriangles);
+    }
+}
+
+void FEZRuntimeMeshSplitter::Start(const FDynamicMesh3& SourceMesh)
+{
+    BufferPositions = TConstArrayView<FVector3f>();
+    BufferIndices = TConstArrayView<uint32>();
+    DuplicatedVertices.Reset();
+    NumParts = 0;
+    NumSkippedTriangles = 0;
+    EmptyScanID = INDEX_NONE;
+
+    Source = &SourceMesh;
+    NumVertexIDs = SourceMesh.MaxVertexID();
+    NumTriangleIDs = SourceMesh.MaxTriangleID();
+    BeginInit();
+}
+
+void FEZRuntimeMeshSplitter::StartFromBuffers(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices)
+{
+    BufferPositions = Positions;
+    BufferIndices = Indices;
+    DuplicatedVertices.Reset();
+    NumParts = 0;
+    NumSkippedTriangles = 0;
+
+    Source = nullptr;
+    NumVertexIDs = 0;
+    NumTriangleIDs = 0;
+    Phase = EPhase::ClearBuffer;
+    Cursor = 0;
+    EmptyScanID = INDEX_NONE;
+}
+
+bool FEZRuntimeMeshSplitter::Tick(double BudgetSeconds)
+{
+    // Always make progress, even with a zero budget
+    const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+    while (Phase != EPhase::Idle && Phase != EPhase::Done)
+    {
+        RunChunk();
+        if (FPlatformTime::Seconds() >= EndTime)
+        {
+            break;
+        }
+    }
+
+    return Phase == EPhase::Done;
+}
+
+const FDynamicMesh3& FEZRuntimeMeshSplitter::GetPart(int32 PartIndex) const
+{
+    check(PartIndex >= 0 && PartIndex < NumParts);
+    return *PartPool[PartIndex];
+}
+
+FDynamicMesh3 FEZRuntimeMeshSplitter::TakePart(int32 PartIndex)
+{
+    check(PartIndex >= 0 && PartIndex < NumParts);
+    return MoveTemp(*PartPool[PartIndex]);
+}
+
+void FEZRuntimeMeshSplitter::BeginInit()
+{
+    Parents.Reset();
+    Parents.SetNumUninitialized(NumVertexIDs);
+    RootHasTriangles.SetNumUninitialized(NumVertexIDs);
+    Copier.SetSource(*Source, NumVertexIDs);
+
+    Phase = EPhase::Init;
+    Cursor = 0;
+}
+
+void FEZRuntimeMeshSplitter::RunChunk()
+{
+    switch (Phase)
+    {
+    case EPhase::ClearBuffer:
+    {
+        int32 WorkLeft = EZSplitRuntimeChunkSize;
+        if (EmptyMeshKeepingCapacity(BufferMesh, EmptyScanID, WorkLeft))
+        {
+            BufferVertexIDs.Reset();
+            BufferVertexIDs.SetNumUninitialized(BufferPositions.Num());
+            Phase = EPhase::Load;
+            Cursor = 0;
+        }
+        break;
+    }
+    case EPhase::Load:
+    {
+        // Vertices first, then triangles, as one cursor range. Reused vertex IDs need not match the input indices.
+        const int32 NumVertices = BufferPositions.Num();
+        const int32 NumItems = NumVertices + BufferIndices.Num() / 3;
+        const int32 End = FMath::Min(Cursor + EZSplitRuntimeChunkSize, NumItems);
+        for (; Cursor < End; ++Cursor)
+        {
+            if (Cursor < NumVertices)
+            {
+                BufferVertexIDs[Cursor] = BufferMesh.AppendVertex(FVector3d(BufferPositions[Cursor]));
+                continue;
+            }
+
+            const int32 Tri = Cursor - NumVertices;
+            const uint32 IndexA = BufferIndices[Tri * 3];
+            const uint32 IndexB = BufferIndices[Tri * 3 + 1];
+            const uint32 IndexC = BufferIndices[Tri * 3 + 2];
+            if (IndexA >= uint32(NumVertices) || IndexB >= uint32(NumVertices) || IndexC >= uint32(NumVertices))
+            {
+                ++NumSkippedTriangles;
+                continue;
+            }
+
+            const FIndex3i Triangle(BufferVertexIDs[IndexA], BufferVertexIDs[IndexB], BufferVertexIDs[IndexC]);
+            int32 TriangleID = BufferMesh.AppendTriangle(Triangle);
+            if (TriangleID < 0 && TriangleID != FDynamicMesh3::InvalidID)
+            {
+                // Topology rejections (non-manifold edges, repeated faces) are valid input; only degenerate triangles are dropped.
+                // Give the triangle its own vertices; Union links them back so it stays in the same part.
+                const FIndex3i Duplicates(
+                    BufferMesh.AppendVertex(BufferMesh.GetVertex(Triangle.A)),
+                    BufferMesh.AppendVertex(BufferMesh.GetVertex(Triangle.B)),
+                    BufferMesh.AppendVertex(BufferMesh.GetVertex(Triangle.C)));
+                TriangleID = BufferMesh.AppendTriangle(Duplicates);
+                if (TriangleID >= 0)
+                {
+                    DuplicatedVertices.Emplace(Triangle.A, Duplicates.A);
+                    DuplicatedVertices.Emplace(Triangle.B, Duplicates.B);
+                    DuplicatedVertices.Emplace(Triangle.C, Duplicates.C);
+                }
+            }
+            if (TriangleID < 0)
+            {
+                ++NumSkippedTriangles;
+            }
+        }
+
+        if (Cursor == NumItems)
+        {
+            if (NumSkippedTriangles > 0)
+            {
+                UE_LOG(LogEZSplitRuntime, Warning, TEXT("FEZRuntimeMeshSplitter: Skipped %d invalid triangles."), NumSkippedTriangles);
+            }
+
+            // The buffer was empty when loading began, so its IDs run from zero up to its counts,
+            // whatever storage earlier jobs left it with
+            Source = &BufferMesh;
+            NumVertexIDs = BufferMesh.VertexCount();
+            NumTriangleIDs = BufferMesh.TriangleCount();
+            BeginInit();
+        }
+        break;
+    }
+    case EPhase::Init:
+    {
+        const int32 NumEntries = FMath::Max(Parents.Num(), Copier.GetNumRemapEntries());
+        const int32 End = FMath::Min(Cursor + EZSplitRuntimeChunkSize, NumEntries);
+        for (int32 VertexID = Cursor; VertexID < FMath::Min(End, Parents.Num()); ++VertexID)
+        {
+            Parents[VertexID] = VertexID;
+            RootHasTriangles[VertexID] = false;
+        }
+        Copier.ResetRemaps(Cursor, End);
+
+        Cursor = End;
+        if (Cursor == NumEntries)
+        {
+            Phase = EPhase::Union;
+            Cursor = 0;
+        }
+        break;
+    }
+    case EPhase::Union:
+    {
+        // Duplicated vertex pairs first, then triangles, as one cursor range.
+        // Always link to the lowest root, so every parent is below its child.
+        const int32 NumPairs = DuplicatedVertices.Num();
+        const int32 NumItems = NumPairs + NumTriangleIDs;
+        const int32 End = FMath::Min(Cursor + EZSplitRuntimeChunkSize, NumItems);
+        for (; Cursor < End; ++Cursor)
+        {
+            if (Cursor < NumPairs)
+            {
+                const int32 RootA = FindRoot(Parents, DuplicatedVertices[Cursor].Key);
+                const int32 RootB = FindRoot(Parents, DuplicatedVertices[Cursor].Value);
+                Parents[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
+                continue;
+            }
+
+            const int32 TriangleID = Cursor - NumPairs;
+            if (!Source->IsTriangle(TriangleID))
+            {
+                continue;
+            }
+
+            const FIndex3i Triangle = Source->GetTriangle(TriangleID);
+            const int32 RootA = FindRoot(Parents, Triangle.A);
+            const int32 RootB = FindRoot(Parents, Triangle.B);
+            const int32 RootC = FindRoot(Parents, Triangle.C);
+            const int32 Root = FMath::Min3(RootA, RootB, RootC);
+            Parents[RootA] = Root;
+            Parents[RootB] = Root;
+            Parents[RootC] = Root;
+            RootHasTriangles[Root] = true;
+        }
+
+        if (Cursor == NumItems)
+        {
+            Phase = EPhase::Resolve;
+            Cursor = 0;
+        }
+        break;
+    }
+    case EPhase::Resolve:
+    {
+        // In ascending order a vertex's parent already holds its label; roots without triangles get no part
+        const int32 End = FMath::Min(Cursor + EZSplitRuntimeChunkSize, Parents.Num());
+        for (; Cursor < End; ++Cursor)
+        {
+            if (Parents[Cursor] == Cursor)
+            {
+                Parents[Cursor] = RootHasTriangles[Cursor] ? NumParts++ : IndexConstants::InvalidID;
+            }
+            else
+            {
+                Parents[Cursor] = Parents[Parents[Cursor]];
+            }
+        }
+
+        if (Cursor == Parents.Num())
+        {
+            Phase = EPhase::Prepare;
+            Cursor = 0;
+        }
+        break;
+    }
+    case EPhase::Prepare:
+    {
+        // Pooled parts are emptied in place, so the storage grown by earlier jobs or Reserve is kept
+        int32 WorkLeft = EZSplitRuntimeChunkSize;
+        while (Cursor < NumParts && WorkLeft > 0)
+        {
+            if (!PartPool.IsValidIndex(Cursor))
+            {
+                PartPool.Add(MakeUnique<FDynamicMesh3>());
+            }
+
+            FDynamicMesh3& Part = *PartPool[Cursor];
+            if (!EmptyMeshKeepingCapacity(Part, EmptyScanID, WorkLeft))
+            {
+                break;
+            }
+            Part.EnableMeshComponents(Source->GetComponentsFlags());
+            Part.EnableMatchingAttributes(*Source, false, true);
+
+            --WorkLeft;
+            ++Cursor;
+        }
+
+        if (Cursor == NumParts)
+        {
+            Phase = EPhase::Emit;
+            Cursor = 0;
+        }
+        break;
+    }
+    case EPhase::Emit:
+    {
+        // Every vertex and overlay element belongs to exactly one part, so one remap table serves all parts
+        const int32 End = FMath::Min(Cursor + EZSplitRuntimeChunkSize, NumTriangleIDs);
+        for (; Cursor < End; ++Cursor)
+        {
+            if (Source->IsTriangle(Cursor))
+            {
+                const int32 PartIndex = Parents[Source->GetTriangle(Cursor).A];
+                Copier.CopyTriangle(Cursor, *PartPool[PartIndex]);
+            }
+        }
+
+        if (Cursor == NumTriangleIDs)
+        {
+            Phase = EPhase::Compact;
+            Cursor = 0;
+        }
+        break;
+    }
+    case EPhase::Compact:
+    {
+        // A reused part keeps the ID range of its largest earlier contents. Parts now using less than half of it
+        // are compacted, so code that walks a part by ID pays for at most about twice its size.
+        int32 WorkLeft = EZSplitRuntimeChunkSize;
+        for (; Cursor < NumParts && WorkLeft > 0; ++Cursor)
+        {
+            FDynamicMesh3& Part = *PartPool[Cursor];
+            const int32 NumIDs = Part.MaxVertexID() + Part.MaxTriangleID();
+            if (NumIDs > (Part.VertexCount() + Part.TriangleCount()) * 2 + EZSplitRuntimeChunkSize)
+            {
+                Part.CompactInPlace();
+                WorkLeft -= NumIDs;
+            }
+            else
+            {
+                --WorkLeft;
+            }
+        }
+
+        if (Cursor == NumParts)
+        {
+            Phase = Source == &BufferMesh ? EPhase::Release : EPhase::Done;
+            Cursor = 0;
+        }
+        break;
+    }
+    case EPhase::Release:
+    {
+        // Emptying the raw buffer now keeps its cost in this job instead of the next one
+        int32 WorkLeft = EZSplitRuntimeChunkSize;
+        if (EmptyMeshKeepingCapacity(BufferMesh, EmptyScanID, WorkLeft))
+        {
+            Phase = EPhase::Done;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+// Merge
+void FEZRuntimeMeshMerger::Start(TConstArrayView<const FDynamicMesh3*> InSources, TConstArrayView<FTransformSRT3d> InTransforms)
+{
+    Sources.Reset();
+    Sources.Append(InSources.GetData(), InSources.Num());
+    Transforms.Reset();
+    Transforms.Append(InTransforms.GetData(), InTransforms.Num());
+
+    if (Transforms.Num() != 0 && Transforms.Num() != Sources.Num())
+    {
+        UE_LOG(LogEZSplitRuntime, Warning, TEXT("FEZRuntimeMeshMerger: Expected %d transforms, got %d. Missing ones are treated as identity."), Sources.Num(), Transforms.Num());
+    }
+
+    Result.Clear();
+    if (const FDynamicMesh3* const* FirstSource = Sources.FindByPredicate([](const FDynamicMesh3* Mesh) { return Mesh != nullptr; }))
+    {
+        Result.EnableMeshComponents((*FirstSource)->GetComponentsFlags());
+        Result.EnableMatchingAttributes(**FirstSource);
+    }
+
+    BeginSource(0);
+}
+
+bool FEZRuntimeMeshMerger::Tick(double BudgetSeconds)
+{
+    // Always make progress, even with a zero budget
+    const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+    while (Phase != EPhase::Idle && Phase != EPhase::Done)
+    {
+        RunChunk();
+        if (FPlatformTime::Seconds() >= EndTime)
+        {
+            break;
+        }
+    }
+
+    return Phase == EPhase::Done;
+}
+
+void FEZRuntimeMeshMerger::BeginSource(int32 Index)
+{
+    SourceIndex = Index;
+    while (SourceIndex < Sources.Num() && !Sources[SourceIndex])
+    {
+        ++SourceIndex;
+    }
+
+    if (SourceIndex >= Sources.Num())
+    {
+        Phase = EPhase::Done;
+        return;
+    }
+
+    Copier.SetSource(*Sources[SourceIndex]);
+    Phase = EPhase::Init;
+    Cursor = 0;
+}
+
+void FEZRuntimeMeshMerger::RunChunk()
+{
+    switch (Phase)
+    {
+    case EPhase::Init:
+    {
+        const int32 NumEntries = Copier.GetNumRemapEntries();
+        const int32 End = FMath::Min(Cursor + EZSplitRuntimeChunkSize, NumEntries);
+        Copier.ResetRemaps(Cursor, End);
+
+        Cursor = End;
+        if (Cursor == NumEntries)
+        {
+            Phase = EPhase::Copy;
+            Cursor = 0;
+        }
+        break;
+    }
+    case EPhase::Copy:
+    {
+        const FDynamicMesh3& Source = *Sources[SourceIndex];
+        const FTransformSRT3d* Transform = Transforms.IsValidIndex(SourceIndex) ? &Transforms[SourceIndex] : nullptr;
+
+        const int32 End = FMath::Min(Cursor + EZSplitRuntimeChunkSize, Source.MaxTriangleID());
+        for (; Cursor < End; ++Cursor)
+        {
+            if (Source.IsTriangle(Cursor))
+            {
+                Copier.CopyTriangle(Cursor, Result, Transform);
+            }
+        }
+
+        if (Cursor == Source.MaxTriangleID())
+        {
+            BeginSource(SourceIndex + 1);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+IMPLEMENT_MODULE(FEZSplitRuntimeModule, EZSplitRuntime)
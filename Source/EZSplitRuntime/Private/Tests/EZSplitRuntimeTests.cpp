@@ -0,0 +1,194 @@
+#include "EZSplitRuntime.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace UE::Geometry;
+
+namespace EZSplitRuntimeTests
+{
+    // NumCubes disjoint unit cubes on a grid: 8 vertices and 12 triangles each
+    static void MakeCubeGrid(int32 NumCubes, TArray<FVector3f>& OutPositions, TArray<uint32>& OutIndices)
+    {
+        static const int32 CubeTriangles[12][3] = {
+            { 0, 2, 1 }, { 0, 3, 2 }, { 4, 5, 6 }, { 4, 6, 7 },
+            { 0, 1, 5 }, { 0, 5, 4 }, { 1, 2, 6 }, { 1, 6, 5 },
+            { 2, 3, 7 }, { 2, 7, 6 }, { 3, 0, 4 }, { 3, 4, 7 } };
+
+        const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(float(NumCubes)));
+
+        OutPositions.Reset(NumCubes * 8);
+        OutIndices.Reset(NumCubes * 36);
+        for (int32 Cube = 0; Cube < NumCubes; ++Cube)
+        {
+            const FVector3f Origin(float(Cube % GridSize) * 2.0f, float(Cube / GridSize) * 2.0f, 0.0f);
+            const uint32 BaseVertex = OutPositions.Num();
+            for (int32 Corner = 0; Corner < 8; ++Corner)
+            {
+                OutPositions.Add(Origin + FVector3f(float((Corner + 1) / 2 % 2), float(Corner / 2 % 2), float(Corner / 4)));
+            }
+            for (const int32 (&Triangle)[3] : CubeTriangles)
+            {
+                OutIndices.Add(BaseVertex + Triangle[0]);
+                OutIndices.Add(BaseVertex + Triangle[1]);
+                OutIndices.Add(BaseVertex + Triangle[2]);
+            }
+        }
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEZSplitRuntimeSplitMergeTest, "EZSplit.Runtime.SplitMerge",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FEZSplitRuntimeSplitMergeTest::RunTest(const FString& Parameters)
+{
+    const int32 NumCubes = 64;
+    TArray<FVector3f> Positions;
+    TArray<uint32> Indices;
+    EZSplitRuntimeTests::MakeCubeGrid(NumCubes, Positions, Indices);
+
+    // A tiny budget forces the job across many ticks
+    FEZRuntimeMeshSplitter Splitter;
+    Splitter.StartFromBuffers(Positions, Indices);
+    int32 NumTicks = 0;
+    while (!Splitter.Tick(0.0))
+    {
+        ++NumTicks;
+    }
+
+    TestEqual(TEXT("Part count"), Splitter.GetNumParts(), NumCubes);
+    TestTrue(TEXT("Split spans several ticks"), NumTicks > 0);
+
+    TArray<const FDynamicMesh3*> Parts;
+    for (int32 PartIndex = 0; PartIndex < Splitter.GetNumParts(); ++PartIndex)
+    {
+        const FDynamicMesh3& Part = Splitter.GetPart(PartIndex);
+        TestEqual(TEXT("Part triangle count"), Part.TriangleCount(), 12);
+        TestEqual(TEXT("Part vertex count"), Part.VertexCount(), 8);
+        Parts.Add(&Part);
+    }
+
+    FEZRuntimeMeshMerger Merger;
+    Merger.Start(Parts);
+    while (!Merger.Tick(0.0))
+    {
+    }
+
+    TestEqual(TEXT("Merged triangle count"), Merger.GetResult().TriangleCount(), NumCubes * 12);
+    TestEqual(TEXT("Merged vertex count"), Merger.GetResult().VertexCount(), NumCubes * 8);
+
+    // Splitting the merge result again gives the same parts, reusing the pooled meshes
+    Splitter.Start(Merger.GetResult());
+    while (!Splitter.Tick(0.001))
+    {
+    }
+    TestEqual(TEXT("Part count after merge"), Splitter.GetNumParts(), NumCubes);
+
+    // Three triangles on one edge: the third gets its own vertices but stays in the same part
+    const TArray<FVector3f> FinPositions = { FVector3f(0, 0, 0), FVector3f(1, 0, 0), FVector3f(0, 1, 0), FVector3f(0, -1, 0), FVector3f(0, 0, 1) };
+    const TArray<uint32> FinIndices = { 0, 1, 2, 1, 0, 3, 0, 1, 4 };
+    Splitter.StartFromBuffers(FinPositions, FinIndices);
+    while (!Splitter.Tick(0.0))
+    {
+    }
+    TestEqual(TEXT("Non-manifold part count"), Splitter.GetNumParts(), 1);
+    TestEqual(TEXT("Non-manifold part triangle count"), Splitter.GetPart(0).TriangleCount(), 3);
+
+    // A double-sided face repeats the same triangle with the other winding; both sides stay in one part
+    const TArray<FVector3f> FacePositions = { FVector3f(0, 0, 0), FVector3f(1, 0, 0), FVector3f(0, 1, 0) };
+    const TArray<uint32> FaceIndices = { 0, 1, 2, 0, 2, 1 };
+    Splitter.StartFromBuffers(FacePositions, FaceIndices);
+    while (!Splitter.Tick(0.0))
+    {
+    }
+    TestEqual(TEXT("Double-sided part count"), Splitter.GetNumParts(), 1);
+    TestEqual(TEXT("Double-sided part triangle count"), Splitter.GetPart(0).TriangleCount(), 2);
+
+    // A mirroring transform must keep the triangle facing the same way
+    FDynamicMesh3 Triangle;
+    Triangle.AppendTriangle(Triangle.AppendVertex(FVector3d(0, 0, 0)), Triangle.AppendVertex(FVector3d(1, 0, 0)), Triangle.AppendVertex(FVector3d(0, 1, 0)));
+    const TArray<const FDynamicMesh3*> MirrorSources = { &Triangle };
+    const TArray<FTransformSRT3d> MirrorTransforms = { FTransformSRT3d(FQuaterniond::Identity(), FVector3d::Zero(), FVector3d(-1, 1, 1)) };
+    Merger.Start(MirrorSources, MirrorTransforms);
+    while (!Merger.Tick(0.0))
+    {
+    }
+    TestTrue(TEXT("Mirrored merge keeps facing"), Merger.GetResult().GetTriNormal(0).Dot(Triangle.GetTriNormal(0)) > 0.99);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEZSplitRuntimeLatencyTest, "EZSplit.Runtime.SplitLatency",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FEZSplitRuntimeLatencyTest::RunTest(const FString& Parameters)
+{
+    const double FrameBudgetSeconds = 0.002;
+    const int32 CubeCounts[] = { 100, 1000, 10000, 50000 };
+
+    FEZRuntimeMeshSplitter Splitter;
+    for (const int32 NumCubes : CubeCounts)
+    {
+        TArray<FVector3f> Positions;
+        TArray<uint32> Indices;
+        EZSplitRuntimeTests::MakeCubeGrid(NumCubes, Positions, Indices);
+
+        Splitter.Reserve(Positions.Num(), NumCubes * 12, NumCubes);
+
+        const double StartTime = FPlatformTime::Seconds();
+        double LongestTickSeconds = 0.0;
+        int32 NumTicks = 0;
+
+        Splitter.StartFromBuffers(Positions, Indices);
+        bool bDone = false;
+        while (!bDone)
+        {
+            const double TickStart = FPlatformTime::Seconds();
+            bDone = Splitter.Tick(FrameBudgetSeconds);
+            LongestTickSeconds = FMath::Max(LongestTickSeconds, FPlatformTime::Seconds() - TickStart);
+            ++NumTicks;
+        }
+
+        const double TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+        TestEqual(FString::Printf(TEXT("Part count for %d cubes"), NumCubes), Splitter.GetNumParts(), NumCubes);
+        AddInfo(FString::Printf(TEXT("%d triangles: %.2f ms total over %d ticks, longest tick %.3f ms (budget %.3f ms)"),
+            NumCubes * 12, TotalSeconds * 1000.0, NumTicks, LongestTickSeconds * 1000.0, FrameBudgetSeconds * 1000.0));
+    }
+
+    // Pools grown by a large reserve or a large job must not slow down later small splits. A zero budget runs
+    // one chunk per tick, so the tick count measures the work done.
+    auto CountChunks = [](FEZRuntimeMeshSplitter& InSplitter, const TArray<FVector3f>& Positions, const TArray<uint32>& Indices) {
+        InSplitter.StartFromBuffers(Positions, Indices);
+        int32 NumChunks = 1;
+        while (!InSplitter.Tick(0.0))
+        {
+            ++NumChunks;
+        }
+        return NumChunks;
+        };
+
+    TArray<FVector3f> SmallPositions;
+    TArray<uint32> SmallIndices;
+    EZSplitRuntimeTests::MakeCubeGrid(100, SmallPositions, SmallIndices);
+
+    // Each splitter runs one small job first, so all of them reuse parts a small job filled
+    FEZRuntimeMeshSplitter SmallSplitter;
+    CountChunks(SmallSplitter, SmallPositions, SmallIndices);
+    const int32 BaselineChunks = CountChunks(SmallSplitter, SmallPositions, SmallIndices);
+
+    // The first job after the reserve compacts the oversized part
+    FEZRuntimeMeshSplitter ReservedSplitter;
+    ReservedSplitter.Reserve(1000000, 1000000, 1);
+    CountChunks(ReservedSplitter, SmallPositions, SmallIndices);
+    TestEqual(TEXT("Chunks for a small split after a large reserve"), CountChunks(ReservedSplitter, SmallPositions, SmallIndices), BaselineChunks);
+
+    // Splitter last ran the largest case above
+    CountChunks(Splitter, SmallPositions, SmallIndices);
+    TestEqual(TEXT("Chunks for a small split after a large job"), CountChunks(Splitter, SmallPositions, SmallIndices), BaselineChunks);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,185 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "TransformTypes.h"
+
+class FEZSplitRuntimeModule : public IModuleInterface
+{
+public:
+
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
+
+/**
+ * Copies triangles between dynamic meshes, appending each source vertex and overlay element once.
+ * Remap tables are kept between sources so their allocations are reused.
+ */
+class EZSPLITRUNTIME_API FEZDynamicMeshCopier
+{
+public:
+
+	/** Preallocates remap tables for sources up to the given vertex and overlay element counts. */
+	void Reserve(int32 MaxVertices, int32 MaxElements);
+
+	/**
+	 * Points the copier at a new source. Remap entries must be cleared with ResetRemaps before copying.
+	 * VertexIDLimit bounds the vertex IDs that will be copied, when the source uses fewer than MaxVertexID.
+	 */
+	void SetSource(const UE::Geometry::FDynamicMesh3& InSource, int32 VertexIDLimit = INDEX_NONE);
+
+	/** Number of entries ResetRemaps has to cover for the current source. */
+	int32 GetNumRemapEntries() const;
+
+	/** Clears remap entries in [Begin, End), so the reset can be spread across frames. */
+	void ResetRemaps(int32 Begin, int32 End);
+
+	/**
+	 * Copies one source triangle with its group, per-vertex attributes, overlays, material ID and polygroups.
+	 * A transform with negative determinant flips the winding. Returns the new triangle ID, or a negative error.
+	 */
+	int32 CopyTriangle(int32 SourceTriangleID, UE::Geometry::FDynamicMesh3& Target, const UE::Geometry::FTransformSRT3d* Transform = nullptr);
+
+private:
+
+	const UE::Geometry::FDynamicMesh3* Source = nullptr;
+	TArray<int32> VertexRemap;
+	TArray<TArray<int32>> UVRemaps;
+	TArray<TArray<int32>> NormalRemaps;
+	TArray<int32> ColorRemap;
+};
+
+/**
+ * Time-sliced loose-part split of a dynamic mesh.
+ * Start a job, then call Tick once per frame with that frame's budget until it returns true.
+ * Working arrays and part meshes are pooled: a part is emptied without releasing its storage, so later
+ * jobs reuse it. Each phase only covers the IDs the current job uses, however large the pools have grown.
+ * A reused part may have unused IDs past its elements; one left with more than it holds is compacted.
+ */
+class EZSPLITRUNTIME_API FEZRuntimeMeshSplitter
+{
+public:
+
+	/**
+	 * Preallocates working storage, the raw buffer mesh and MaxParts part meshes, each sized for an even share
+	 * of MaxVertices and MaxTriangles. With AttributeLayout, parts also get matching attributes and overlay capacity.
+	 * A part that a job fills to less than half its share is compacted, giving the rest back.
+	 * Empties the parts of any previous job.
+	 */
+	void Reserve(int32 MaxVertices, int32 MaxTriangles, int32 MaxParts, const UE::Geometry::FDynamicMesh3* AttributeLayout = nullptr);
+
+	/** Begins splitting SourceMesh, which must stay alive and unchanged until the job is done. */
+	void Start(const UE::Geometry::FDynamicMesh3& SourceMesh);
+
+	/**
+	 * Begins splitting a raw triangle list. The buffers must stay alive until the job is done.
+	 * Triangles the mesh topology rejects, such as those on non-manifold edges or repeating another face,
+	 * get their own copies of the vertices but stay in their part. Degenerate triangles are skipped.
+	 */
+	void StartFromBuffers(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices);
+
+	/** Advances the job for about BudgetSeconds. Returns true once every part is built. */
+	bool Tick(double BudgetSeconds);
+
+	bool IsDone() const { return Phase == EPhase::Done; }
+	int32 GetNumParts() const { return NumParts; }
+
+	/** Parts of the finished job. They stay owned by the splitter and are reused by the next job. */
+	const UE::Geometry::FDynamicMesh3& GetPart(int32 PartIndex) const;
+
+	/** Moves a part out of the pool. */
+	UE::Geometry::FDynamicMesh3 TakePart(int32 PartIndex);
+
+private:
+
+	enum class EPhase : uint8
+	{
+		Idle,
+		ClearBuffer,
+		Load,
+		Init,
+		Union,
+		Resolve,
+		Prepare,
+		Emit,
+		Compact,
+		Release,
+		Done
+	};
+
+	void RunChunk();
+	void BeginInit();
+
+	const UE::Geometry::FDynamicMesh3* Source = nullptr;
+	EPhase Phase = EPhase::Idle;
+	int32 Cursor = 0;
+	int32 NumParts = 0;
+
+	// Upper bounds of the vertex and triangle IDs this job reads from Source
+	int32 NumVertexIDs = 0;
+	int32 NumTriangleIDs = 0;
+
+	// Raw buffer input is loaded into BufferMesh before splitting
+	TConstArrayView<FVector3f> BufferPositions;
+	TConstArrayView<uint32> BufferIndices;
+	UE::Geometry::FDynamicMesh3 BufferMesh;
+	TArray<int32> BufferVertexIDs;
+	TArray<TPair<int32, int32>> DuplicatedVertices;
+	int32 NumSkippedTriangles = 0;
+
+	// Scan position while a pooled mesh is being emptied
+	int32 EmptyScanID = INDEX_NONE;
+
+	// Union-find over vertex IDs, resolved in place into part labels
+	TArray<int32> Parents;
+	TBitArray<> RootHasTriangles;
+	FEZDynamicMeshCopier Copier;
+	TArray<TUniquePtr<UE::Geometry::FDynamicMesh3>> PartPool;
+};
+
+/**
+ * Time-sliced merge of dynamic meshes into one, the reverse of FEZRuntimeMeshSplitter.
+ * Attribute layers follow the first source; layers missing from a later source are left unset.
+ */
+class EZSPLITRUNTIME_API FEZRuntimeMeshMerger
+{
+public:
+
+	/** Begins merging Sources, each placed by the matching transform if any are given. Sources must stay alive until the job is done. */
+	void Start(TConstArrayView<const UE::Geometry::FDynamicMesh3*> InSources, TConstArrayView<UE::Geometry::FTransformSRT3d> InTransforms = {});
+
+	/** Advances the job for about BudgetSeconds. Returns true once every source is appended. */
+	bool Tick(double BudgetSeconds);
+
+	bool IsDone() const { return Phase == EPhase::Done; }
+
+	const UE::Geometry::FDynamicMesh3& GetResult() const { return Result; }
+	UE::Geometry::FDynamicMesh3 TakeResult() { return MoveTemp(Result); }
+
+private:
+
+	enum class EPhase : uint8
+	{
+		Idle,
+		Init,
+		Copy,
+		Done
+	};
+
+	void RunChunk();
+	void BeginSource(int32 Index);
+
+	TArray<const UE::Geometry::FDynamicMesh3*> Sources;
+	TArray<UE::Geometry::FTransformSRT3d> Transforms;
+	int32 SourceIndex = 0;
+	EPhase Phase = EPhase::Idle;
+	int32 Cursor = 0;
+
+	UE::Geometry::FDynamicMesh3 Result;
+	FEZDynamicMeshCopier Copier;
+};